@@ -0,0 +1,72 @@
+#ifndef _S21_ALIGNED_ALLOCATOR_H_
+#define _S21_ALIGNED_ALLOCATOR_H_
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+
+#include "s21_vector.h"
+
+namespace s21 {
+
+// Allocator for SIMD kernels: every chunk starts at an Alignment boundary
+// and is padded up to whole Alignment-byte blocks, so an aligned load of up
+// to Alignment bytes which starts inside the chunk never leaves it - loops
+// may read whole registers at the tail instead of peeling it off
+template <typename Type, std::size_t Alignment = 64ull>
+class AlignedAllocator {
+  static_assert(Alignment && !(Alignment & (Alignment - 1ull)),
+                "Alignment should be a power of two!");
+  static_assert(Alignment >= alignof(Type),
+                "Alignment should not be less than alignof(Type)!");
+
+ public:
+  using value_type = Type;
+  using size_type = std::size_t;
+  using is_always_equal = std::true_type;
+
+  static constexpr size_type kAlignment = Alignment;
+
+  template <typename Other>
+  struct rebind {
+    using other = AlignedAllocator<Other, Alignment>;
+  };
+
+ public:
+  AlignedAllocator() noexcept = default;
+  template <typename Other>
+  AlignedAllocator(const AlignedAllocator<Other, Alignment>&) noexcept {}
+
+  Type* allocate(size_type count) {
+    return static_cast<Type*>(
+        ::operator new(padded(count), std::align_val_t(Alignment)));
+  }
+
+  void deallocate(Type* pointer, size_type count) noexcept {
+    ::operator delete(pointer, padded(count), std::align_val_t(Alignment));
+  }
+
+  template <typename Other>
+  bool operator==(const AlignedAllocator<Other, Alignment>&) const noexcept {
+    return true;
+  }
+  template <typename Other>
+  bool operator!=(const AlignedAllocator<Other, Alignment>&) const noexcept {
+    return false;
+  }
+
+ private:
+  static size_type padded(size_type count) noexcept {
+    return (count * sizeof(Type) + Alignment - 1ull) / Alignment * Alignment;
+  }
+};
+
+// Data() is aligned to Alignment bytes whatever Type is
+template <typename Type, std::size_t Alignment = 64ull,
+          typename GrowthPolicy = Growth::PowerOfTwo>
+using AlignedVector =
+    Vector<Type, GrowthPolicy, AlignedAllocator<Type, Alignment>>;
+
+}  // namespace s21
+
+#endif  //  _S21_ALIGNED_ALLOCATOR_H_
@@ -11,8 +11,16 @@
 
 namespace s21 {
 
-template <typename Type, std::size_t N>
+// Alignment over alignof(Type) lets SIMD kernels use aligned loads on
+// Data(); the size of the Array is then a multiple of it, so the tail is
+// padded up to a whole Alignment-byte block
+template <typename Type, std::size_t N, std::size_t Alignment = alignof(Type)>
 class Array {
+  static_assert(Alignment && !(Alignment & (Alignment - 1ull)),
+                "Alignment should be a power of two!");
+  static_assert(Alignment >= alignof(Type),
+                "Alignment should not be less than alignof(Type)!");
+
  public:
   using value_type = Type;
   using size_type = std::size_t;
@@ -24,15 +32,14 @@ class Array {
   using const_pointer = const value_type *;
 
  public:
-  using iterator = VectorIterator<Array<Type, N> >;
-  using const_iterator =
-      VectorIterator<Array<Type, N>, const_pointer, const_reference>;
-  using reverse_iterator = VectorReverseIterator<Array<Type, N> >;
+  using iterator = VectorIterator<Array>;
+  using const_iterator = VectorIterator<Array, const_pointer, const_reference>;
+  using reverse_iterator = VectorReverseIterator<Array>;
   using const_reverse_iterator =
-      VectorReverseIterator<Array<Type, N>, const_pointer, const_reference>;
+      VectorReverseIterator<Array, const_pointer, const_reference>;
 
  private:
-  value_type data_[N];
+  alignas(Alignment) value_type data_[N];
 
  public:
   Array() {
@@ -126,9 +133,10 @@ class Array {
   }
 };
 
-template <typename Type, std::size_t N1, std::size_t N2>
-constexpr bool operator==(const Array<Type, N1> &left,
-                          const Array<Type, N2> &right) {
+template <typename Type, std::size_t N1, std::size_t N2,
+          std::size_t Alignment1, std::size_t Alignment2>
+constexpr bool operator==(const Array<Type, N1, Alignment1> &left,
+                          const Array<Type, N2, Alignment2> &right) {
   if constexpr (N1 != N2) return false;
 
   auto left_iterator = left.cbegin();
@@ -143,9 +151,10 @@ constexpr bool operator==(const Array<Type, N1> &left,
   return true;
 }
 
-template <typename Type, std::size_t N1, std::size_t N2>
-constexpr bool operator!=(const Array<Type, N1> &left,
-                          const Array<Type, N2> &right) {
+template <typename Type, std::size_t N1, std::size_t N2,
+          std::size_t Alignment1, std::size_t Alignment2>
+constexpr bool operator!=(const Array<Type, N1, Alignment1> &left,
+                          const Array<Type, N2, Alignment2> &right) {
   return !(left == right);
 }
 
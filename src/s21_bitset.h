@@ -0,0 +1,606 @@
+#ifndef _S21_BITSET_H_
+#define _S21_BITSET_H_
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_vector.h"
+
+namespace s21 {
+
+// One bit of a word, what operator[] of a packed container gives instead of
+// bool&
+template <typename Word>
+class BitReference {
+ private:
+  Word* word_;
+  Word mask_;
+
+ public:
+  BitReference(Word* word, Word mask) noexcept : word_{word}, mask_{mask} {}
+  BitReference(const BitReference& other) noexcept = default;
+
+  operator bool() const noexcept { return *word_ & mask_; }
+  bool operator~() const noexcept { return !static_cast<bool>(*this); }
+
+  BitReference& operator=(bool value) noexcept {
+    if (value)
+      *word_ |= mask_;
+    else
+      *word_ &= ~mask_;
+    return *this;
+  }
+  // assigns the bit, not the reference
+  BitReference& operator=(const BitReference& other) noexcept {
+    return *this = static_cast<bool>(other);
+  }
+
+  void Flip() noexcept { *word_ ^= mask_; }
+
+  // std algorithms swap the bits through it
+  friend void swap(BitReference left, BitReference right) noexcept {
+    const bool temporary = left;
+    left = static_cast<bool>(right);
+    right = temporary;
+  }
+};
+
+// Iterator over the bits of words: the word and the number of the bit in it.
+// Dereferencing gives BitReference, or just bool for a const iterator
+template <typename WordPointer, typename Reference>
+class BitIterator {
+ public:
+  using word_type = std::remove_const_t<std::remove_pointer_t<WordPointer>>;
+  using difference_type = std::ptrdiff_t;
+  using value_type = bool;
+  using pointer = void;
+  using reference = Reference;
+  using iterator_category = std::random_access_iterator_tag;
+
+  template <typename OtherPointer, typename OtherReference>
+  friend class BitIterator;  // to compare const_iterator with iterator
+
+ private:
+  static constexpr difference_type kWordBits = sizeof(word_type) * 8;
+
+  WordPointer word_;
+  unsigned offset_;
+
+ public:
+  BitIterator(WordPointer word, unsigned offset) noexcept
+      : word_{word}, offset_{offset} {}
+
+  // iterator converts to const_iterator
+  template <typename OtherPointer, typename OtherReference>
+  BitIterator(const BitIterator<OtherPointer, OtherReference>& other) noexcept
+      : word_{other.word_}, offset_{other.offset_} {}
+
+  reference operator*() const noexcept {
+    if constexpr (std::is_same_v<reference, bool>)
+      return (*word_ >> offset_) & word_type(1);
+    else
+      return reference(word_, word_type(1) << offset_);
+  }
+  reference operator[](difference_type n) const noexcept {
+    return *(*this + n);
+  }
+
+  BitIterator& operator++() noexcept {
+    if (++offset_ == kWordBits) {
+      offset_ = 0u;
+      ++word_;
+    }
+    return *this;
+  }
+  BitIterator operator++(int) noexcept {
+    BitIterator temporary(*this);
+    ++*this;
+    return temporary;
+  }
+  BitIterator& operator--() noexcept {
+    if (offset_-- == 0u) {
+      offset_ = kWordBits - 1;
+      --word_;
+    }
+    return *this;
+  }
+  BitIterator operator--(int) noexcept {
+    BitIterator temporary(*this);
+    --*this;
+    return temporary;
+  }
+
+  BitIterator& operator+=(difference_type n) noexcept {
+    const difference_type position = static_cast<difference_type>(offset_) + n;
+    word_ += position >= 0 ? position / kWordBits
+                           : -((kWordBits - 1 - position) / kWordBits);
+    offset_ = static_cast<unsigned>(position & (kWordBits - 1));
+    return *this;
+  }
+  BitIterator& operator-=(difference_type n) noexcept { return *this += -n; }
+  BitIterator operator+(difference_type n) const noexcept {
+    BitIterator temporary(*this);
+    return temporary += n;
+  }
+  BitIterator operator-(difference_type n) const noexcept {
+    BitIterator temporary(*this);
+    return temporary -= n;
+  }
+  template <typename OtherPointer, typename OtherReference>
+  difference_type operator-(
+      const BitIterator<OtherPointer, OtherReference>& other) const noexcept {
+    return (word_ - other.word_) * kWordBits +
+           static_cast<difference_type>(offset_) -
+           static_cast<difference_type>(other.offset_);
+  }
+
+  template <typename OtherPointer, typename OtherReference>
+  bool operator==(
+      const BitIterator<OtherPointer, OtherReference>& other) const noexcept {
+    return word_ == other.word_ && offset_ == other.offset_;
+  }
+  template <typename OtherPointer, typename OtherReference>
+  bool operator!=(
+      const BitIterator<OtherPointer, OtherReference>& other) const noexcept {
+    return !(*this == other);
+  }
+  template <typename OtherPointer, typename OtherReference>
+  bool operator<(
+      const BitIterator<OtherPointer, OtherReference>& other) const noexcept {
+    return *this - other < 0;
+  }
+  template <typename OtherPointer, typename OtherReference>
+  bool operator>(
+      const BitIterator<OtherPointer, OtherReference>& other) const noexcept {
+    return other < *this;
+  }
+  template <typename OtherPointer, typename OtherReference>
+  bool operator<=(
+      const BitIterator<OtherPointer, OtherReference>& other) const noexcept {
+    return !(other < *this);
+  }
+  template <typename OtherPointer, typename OtherReference>
+  bool operator>=(
+      const BitIterator<OtherPointer, OtherReference>& other) const noexcept {
+    return !(*this < other);
+  }
+};
+
+// Bits packed into 64-bit words kept in a Vector. Counting, searching and
+// the logical operations go word by word; the bits of the last word above
+// Size() are always zero, so whole words may be used everywhere
+template <typename GrowthPolicy = Growth::PowerOfTwo,
+          typename Allocator = std::allocator<std::uint64_t>>
+class DynamicBitset {
+ public:
+  using word_type = std::uint64_t;
+  using allocator_type = Allocator;
+  using value_type = bool;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = BitReference<word_type>;
+  using const_reference = bool;
+
+  using iterator = BitIterator<word_type*, reference>;
+  using const_iterator = BitIterator<const word_type*, const_reference>;
+
+  static constexpr size_type kWordBits = 64ull;
+  static constexpr size_type npos = static_cast<size_type>(-1);
+
+ private:
+  using word_allocator_type = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<word_type>;
+
+  Vector<word_type, GrowthPolicy, word_allocator_type> words_;
+  size_type size_;
+
+ public:
+  DynamicBitset() noexcept(noexcept(Allocator())) : words_{}, size_{0ull} {}
+  explicit DynamicBitset(const Allocator& allocator) noexcept
+      : words_(word_allocator_type(allocator)), size_{0ull} {}
+
+  explicit DynamicBitset(size_type count, bool value = false,
+                         const Allocator& allocator = Allocator())
+      : words_(wordsFor(count), value ? ~word_type(0) : word_type(0),
+               word_allocator_type(allocator)),
+        size_{count} {
+    trim();
+  }
+  DynamicBitset(std::initializer_list<bool> list,
+                const Allocator& allocator = Allocator())
+      : DynamicBitset(list.size(), false, allocator) {
+    size_type pos = 0ull;
+    for (bool value : list) Set(pos++, value);
+  }
+
+  allocator_type Get_allocator() const noexcept {
+    return allocator_type(words_.Get_allocator());
+  }
+
+  reference operator[](size_type pos) noexcept {
+    return reference(words_.Data() + pos / kWordBits, mask(pos));
+  }
+  const_reference operator[](size_type pos) const noexcept {
+    return words_[pos / kWordBits] & mask(pos);
+  }
+
+  bool Test(size_type pos) const {
+    if (pos >= size_) throw std::out_of_range("Index is out of range!");
+    return operator[](pos);
+  }
+
+  DynamicBitset& Set(size_type pos, bool value = true) {
+    operator[](pos) = value;
+    return *this;
+  }
+  DynamicBitset& Reset(size_type pos) { return Set(pos, false); }
+  DynamicBitset& Flip(size_type pos) {
+    words_[pos / kWordBits] ^= mask(pos);
+    return *this;
+  }
+
+  DynamicBitset& Set() noexcept {
+    std::fill(words_.begin(), words_.end(), ~word_type(0));
+    trim();
+    return *this;
+  }
+  DynamicBitset& Reset() noexcept {
+    std::fill(words_.begin(), words_.end(), word_type(0));
+    return *this;
+  }
+  DynamicBitset& Flip() noexcept {
+    for (auto& word : words_) word = ~word;
+    trim();
+    return *this;
+  }
+
+  // a popcount per word, which compilers turn into the popcnt instruction or
+  // a vectorized loop when the target has them
+  size_type Count() const noexcept {
+    size_type count = 0ull;
+    for (word_type word : words_)
+      count += static_cast<size_type>(__builtin_popcountll(word));
+    return count;
+  }
+  bool Any() const noexcept {
+    return std::any_of(words_.cbegin(), words_.cend(),
+                       [](word_type word) { return word != 0ull; });
+  }
+  bool None() const noexcept { return !Any(); }
+  bool All() const noexcept { return Count() == size_; }
+
+  // the index of the first set bit or npos
+  size_type Find_first() const noexcept { return findFrom(0ull); }
+  // the index of the first set bit after pos or npos
+  size_type Find_next(size_type pos) const noexcept {
+    return pos + 1ull >= size_ ? npos : findFrom(pos + 1ull);
+  }
+
+  // the sizes of the operands should be equal
+  DynamicBitset& operator&=(const DynamicBitset& other) noexcept {
+    assert(size_ == other.size_ && "Bitsets of different sizes!");
+    for (size_type i = 0ull; i < words_.Size(); ++i)
+      words_[i] &= other.words_[i];
+    return *this;
+  }
+  DynamicBitset& operator|=(const DynamicBitset& other) noexcept {
+    assert(size_ == other.size_ && "Bitsets of different sizes!");
+    for (size_type i = 0ull; i < words_.Size(); ++i)
+      words_[i] |= other.words_[i];
+    return *this;
+  }
+  DynamicBitset& operator^=(const DynamicBitset& other) noexcept {
+    assert(size_ == other.size_ && "Bitsets of different sizes!");
+    for (size_type i = 0ull; i < words_.Size(); ++i)
+      words_[i] ^= other.words_[i];
+    return *this;
+  }
+  // clears the bits which are set in other: *this &= ~other without a copy
+  DynamicBitset& And_not(const DynamicBitset& other) noexcept {
+    assert(size_ == other.size_ && "Bitsets of different sizes!");
+    for (size_type i = 0ull; i < words_.Size(); ++i)
+      words_[i] &= ~other.words_[i];
+    return *this;
+  }
+  DynamicBitset operator~() const {
+    DynamicBitset result(*this);
+    return result.Flip();
+  }
+
+  iterator begin() noexcept { return iterator(words_.Data(), 0u); }
+  const_iterator begin() const noexcept { return cbegin(); }
+  const_iterator cbegin() const noexcept {
+    return const_iterator(words_.Data(), 0u);
+  }
+  iterator end() noexcept { return begin() + size_; }
+  const_iterator end() const noexcept { return cend(); }
+  const_iterator cend() const noexcept { return cbegin() + size_; }
+
+  size_type Size() const noexcept { return size_; }
+  bool Empty() const noexcept { return !size_; }
+  size_type Capacity() const noexcept { return words_.Capacity() * kWordBits; }
+
+  // the words themselves, Size() bits rounded up to whole words
+  const word_type* Data() const noexcept { return words_.Data(); }
+  size_type Word_count() const noexcept { return words_.Size(); }
+
+  void Reserve(size_type new_capacity) {
+    words_.Reserve(wordsFor(new_capacity));
+  }
+  void Shrink_to_fit() { words_.Shrink_to_fit(); }
+  void Clear() {
+    words_.Clear();
+    size_ = 0ull;
+  }
+
+  void Push_back(bool value) {
+    if (size_ % kWordBits == 0ull) words_.Push_back(word_type(0));
+    ++size_;
+    Set(size_ - 1ull, value);
+  }
+  void Pop_back() {
+    assert(size_ && "Pop_back from empty bitset!");
+    Resize(size_ - 1ull);
+  }
+
+  void Resize(size_type count, bool value = false) {
+    const size_type old_size = size_;
+    if (value && count > old_size && old_size % kWordBits)
+      words_.Back() |= ~word_type(0) << (old_size % kWordBits);
+    words_.Resize(wordsFor(count), value ? ~word_type(0) : word_type(0));
+    size_ = count;
+    trim();
+  }
+
+  void Swap(DynamicBitset& other) {
+    words_.Swap(other.words_);
+    std::swap(size_, other.size_);
+  }
+
+  bool operator==(const DynamicBitset& other) const noexcept {
+    return size_ == other.size_ &&
+           std::equal(words_.cbegin(), words_.cend(), other.words_.cbegin());
+  }
+  bool operator!=(const DynamicBitset& other) const noexcept {
+    return !(*this == other);
+  }
+
+ private:
+  static size_type wordsFor(size_type bits) noexcept {
+    return (bits + kWordBits - 1ull) / kWordBits;
+  }
+  static word_type mask(size_type pos) noexcept {
+    return word_type(1) << (pos % kWordBits);
+  }
+
+  // zeroes the bits of the last word above size_
+  void trim() noexcept {
+    if (size_ % kWordBits)
+      words_.Back() &= ~(~word_type(0) << (size_ % kWordBits));
+  }
+
+  size_type findFrom(size_type pos) const noexcept {
+    size_type index = pos / kWordBits;
+    if (index >= words_.Size()) return npos;
+
+    word_type word = words_[index] & (~word_type(0) << (pos % kWordBits));
+    while (!word) {
+      if (++index == words_.Size()) return npos;
+      word = words_[index];
+    }
+    return index * kWordBits + static_cast<size_type>(__builtin_ctzll(word));
+  }
+};
+
+template <typename GrowthPolicy, typename Allocator>
+DynamicBitset<GrowthPolicy, Allocator> operator&(
+    DynamicBitset<GrowthPolicy, Allocator> left,
+    const DynamicBitset<GrowthPolicy, Allocator>& right) {
+  return left &= right;
+}
+
+template <typename GrowthPolicy, typename Allocator>
+DynamicBitset<GrowthPolicy, Allocator> operator|(
+    DynamicBitset<GrowthPolicy, Allocator> left,
+    const DynamicBitset<GrowthPolicy, Allocator>& right) {
+  return left |= right;
+}
+
+template <typename GrowthPolicy, typename Allocator>
+DynamicBitset<GrowthPolicy, Allocator> operator^(
+    DynamicBitset<GrowthPolicy, Allocator> left,
+    const DynamicBitset<GrowthPolicy, Allocator>& right) {
+  return left ^= right;
+}
+
+// Vector of flags packed one bit each into DynamicBitset. operator[] and the
+// iterators give BitReference instead of bool&, Bits() gives the words.
+// There is no Data(): single flags have no address
+template <typename GrowthPolicy, typename Allocator>
+class Vector<bool, GrowthPolicy, Allocator> {
+  using bitset_type = DynamicBitset<GrowthPolicy, Allocator>;
+
+ public:
+  using allocator_type = Allocator;
+  using value_type = bool;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = typename bitset_type::reference;
+  using const_reference = bool;
+
+  using iterator = typename bitset_type::iterator;
+  using const_iterator = typename bitset_type::const_iterator;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+ private:
+  bitset_type bits_;
+
+ public:
+  Vector() noexcept(noexcept(Allocator())) : bits_{} {}
+  explicit Vector(const Allocator& allocator) noexcept : bits_(allocator) {}
+
+  explicit Vector(size_type count, bool value,
+                  const Allocator& allocator = Allocator())
+      : bits_(count, value, allocator) {}
+  Vector(std::initializer_list<bool> list,
+         const Allocator& allocator = Allocator())
+      : bits_(list, allocator) {}
+
+  template <typename InputIt,
+            typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+  Vector(InputIt first, InputIt last, const Allocator& allocator = Allocator())
+      : bits_(allocator) {
+    for (; first != last; ++first) bits_.Push_back(*first);
+  }
+
+  allocator_type Get_allocator() const noexcept {
+    return bits_.Get_allocator();
+  }
+
+  void Assign(size_type count, bool value) {
+    bits_ = bitset_type(count, value, bits_.Get_allocator());
+  }
+  template <typename InputIt,
+            typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+  void Assign(InputIt first, InputIt last) {
+    *this = Vector(first, last, bits_.Get_allocator());
+  }
+  void Assign(std::initializer_list<bool> list) {
+    bits_ = bitset_type(list, bits_.Get_allocator());
+  }
+
+  reference At(size_type pos) {
+    if (pos >= Size()) throw std::out_of_range("Index is out of range!");
+    return bits_[pos];
+  }
+  const_reference At(size_type pos) const { return bits_.Test(pos); }
+
+  reference operator[](size_type pos) { return bits_[pos]; }
+  const_reference operator[](size_type pos) const { return bits_[pos]; }
+
+  reference Front() { return bits_[0ull]; }
+  const_reference Front() const { return bits_[0ull]; }
+  reference Back() { return bits_[Size() - 1ull]; }
+  const_reference Back() const { return bits_[Size() - 1ull]; }
+
+  // word by word access: Count, Find_first, the logical operations
+  bitset_type& Bits() noexcept { return bits_; }
+  const bitset_type& Bits() const noexcept { return bits_; }
+
+  iterator begin() noexcept { return bits_.begin(); }
+  const_iterator begin() const noexcept { return bits_.cbegin(); }
+  const_iterator cbegin() const noexcept { return bits_.cbegin(); }
+  iterator end() noexcept { return bits_.end(); }
+  const_iterator end() const noexcept { return bits_.cend(); }
+  const_iterator cend() const noexcept { return bits_.cend(); }
+
+  reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+  const_reverse_iterator rbegin() const noexcept { return crbegin(); }
+  const_reverse_iterator crbegin() const noexcept {
+    return const_reverse_iterator(cend());
+  }
+  reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+  const_reverse_iterator rend() const noexcept { return crend(); }
+  const_reverse_iterator crend() const noexcept {
+    return const_reverse_iterator(cbegin());
+  }
+
+  bool Empty() const noexcept { return bits_.Empty(); }
+  size_type Size() const noexcept { return bits_.Size(); }
+  size_type Max_size() const noexcept {
+    return static_cast<size_type>(-1) / 2ull;
+  }
+  size_type Capacity() const noexcept { return bits_.Capacity(); }
+  void Reserve(size_type new_capacity) { bits_.Reserve(new_capacity); }
+  void Shrink_to_fit() { bits_.Shrink_to_fit(); }
+  void Clear() { bits_.Clear(); }
+
+  iterator Insert(const_iterator pos, bool value) {
+    return Insert(pos, 1ull, value);
+  }
+  iterator Insert(const_iterator pos, size_type count, bool value) {
+    const size_type index = makeRoom(pos, count);
+    std::fill(begin() + index, begin() + index + count, value);
+    return begin() + index;
+  }
+  // the flags are read before any is moved, so the range may be a part of
+  // this vector
+  template <typename InputIt,
+            typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+  iterator Insert(const_iterator pos, InputIt first, InputIt last) {
+    const size_type index = pos - cbegin();
+    const Vector values(first, last, bits_.Get_allocator());
+    makeRoom(pos, values.Size());
+    std::copy(values.begin(), values.end(), begin() + index);
+    return begin() + index;
+  }
+  iterator Insert(const_iterator pos, std::initializer_list<bool> list) {
+    const size_type index = makeRoom(pos, list.size());
+    std::copy(list.begin(), list.end(), begin() + index);
+    return begin() + index;
+  }
+
+  template <typename... Args>
+  iterator Emplace(const_iterator pos, Args&&... args) {
+    return Insert(pos, value_type(std::forward<Args>(args)...));
+  }
+
+  // returns the position after the new flags
+  template <typename... Args>
+  iterator Insert_many(const_iterator pos, Args&&... args) {
+    return Insert(pos, {static_cast<bool>(std::forward<Args>(args))...}) +
+           sizeof...(Args);
+  }
+  template <typename... Args>
+  void Insert_many_back(Args&&... args) {
+    Insert_many(cend(), std::forward<Args>(args)...);
+  }
+
+  iterator Erase(const_iterator pos) { return Erase(pos, pos + 1); }
+  iterator Erase(const_iterator first, const_iterator last) {
+    const difference_type index = first - cbegin();
+    const difference_type count = last - first;
+    std::copy(begin() + index + count, end(), begin() + index);
+    bits_.Resize(Size() - static_cast<size_type>(count));
+    return begin() + index;
+  }
+
+  void Push_back(bool value) { bits_.Push_back(value); }
+  template <typename... Args>
+  void Emplace_back(Args&&... args) {
+    bits_.Push_back(value_type(std::forward<Args>(args)...));
+  }
+  void Pop_back() { bits_.Pop_back(); }
+
+  void Resize(size_type count, bool value = false) {
+    bits_.Resize(count, value);
+  }
+
+  void Flip() noexcept { bits_.Flip(); }
+
+  void Swap(Vector& other) { bits_.Swap(other.bits_); }
+
+ private:
+  // count flags more after pos, the ones from pos on are moved up by count;
+  // gives the index of pos
+  size_type makeRoom(const_iterator pos, size_type count) {
+    const size_type index = pos - cbegin();
+    const size_type old_size = Size();
+    bits_.Resize(old_size + count);
+    std::copy_backward(begin() + index, begin() + old_size, end());
+    return index;
+  }
+};
+
+}  // namespace s21
+
+#endif  //  _S21_BITSET_H_
@@ -0,0 +1,382 @@
+#ifndef _S21_COMPRESSED_VECTOR_H_
+#define _S21_COMPRESSED_VECTOR_H_
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_vector.h"
+
+namespace s21 {
+
+// Codecs: Encode(values, residuals, count) turns a block of values into
+// small residuals and gives the base they are counted from,
+// Decode(base, values, count) turns the residuals back in place.
+// kRandomAccess tells that a value needs only its own residual
+namespace Codec {
+
+// the minimum of the block is the base, every value is its distance to it
+class FrameOfReference {
+ public:
+  static constexpr bool kRandomAccess = true;
+
+  static std::uint32_t Encode(const std::uint32_t* values,
+                              std::uint32_t* residuals,
+                              std::size_t count) noexcept {
+    const std::uint32_t base = *std::min_element(values, values + count);
+    for (std::size_t i = 0ull; i < count; ++i) residuals[i] = values[i] - base;
+    return base;
+  }
+  static void Decode(std::uint32_t base, std::uint32_t* values,
+                     std::size_t count) noexcept {
+    for (std::size_t i = 0ull; i < count; ++i) values[i] += base;
+  }
+};
+
+// for non-decreasing values like posting lists: the first value is the
+// base, every value is its distance to the previous one
+class Delta {
+ public:
+  static constexpr bool kRandomAccess = false;
+
+  static std::uint32_t Encode(const std::uint32_t* values,
+                              std::uint32_t* residuals,
+                              std::size_t count) noexcept {
+    std::uint32_t previous = values[0];
+    for (std::size_t i = 0ull; i < count; ++i) {
+      assert(previous <= values[i] && "Values are not sorted!");
+      residuals[i] = values[i] - previous;
+      previous = values[i];
+    }
+    return values[0];
+  }
+  static void Decode(std::uint32_t base, std::uint32_t* values,
+                     std::size_t count) noexcept {
+    for (std::size_t i = 0ull; i < count; ++i) values[i] = base += values[i];
+  }
+};
+
+}  // namespace Codec
+
+namespace CompressedDetail {
+
+constexpr std::size_t kBlock = 128ull;
+constexpr std::size_t kWordBits = 64ull;
+
+// a block of residuals of bits bits each takes 2 * bits words exactly
+constexpr std::size_t words(std::size_t bits) noexcept {
+  return kBlock * bits / kWordBits;
+}
+
+inline std::uint32_t bitWidth(const std::uint32_t* values) noexcept {
+  std::uint32_t all = 0u;
+  for (std::size_t i = 0ull; i < kBlock; ++i) all |= values[i];
+  std::uint32_t bits = 0u;
+  while (bits < 32u && all >> bits) ++bits;
+  return bits;
+}
+
+inline void pack(const std::uint32_t* values, std::uint32_t bits,
+                 std::uint64_t* out) noexcept {
+  std::fill(out, out + words(bits), 0ull);
+  if (!bits) return;
+  for (std::size_t i = 0ull; i < kBlock; ++i) {
+    const std::size_t bit = i * bits;
+    const std::size_t shift = bit % kWordBits;
+    out[bit / kWordBits] |= std::uint64_t{values[i]} << shift;
+    if (shift + bits > kWordBits)
+      out[bit / kWordBits + 1ull] |= std::uint64_t{values[i]} >>
+                                     (kWordBits - shift);
+  }
+}
+
+// residual i of a block
+inline std::uint32_t unpackOne(const std::uint64_t* in, std::uint32_t bits,
+                               std::size_t i) noexcept {
+  if (!bits) return 0u;
+  const std::size_t bit = i * bits;
+  const std::size_t shift = bit % kWordBits;
+  std::uint64_t value = in[bit / kWordBits] >> shift;
+  if (shift + bits > kWordBits)
+    value |= in[bit / kWordBits + 1ull] << (kWordBits - shift);
+  return static_cast<std::uint32_t>(value & ((1ull << bits) - 1ull));
+}
+
+// one unpacker per width: with Bits known the loop is unrolled into
+// constant shifts and masks, which compilers vectorize
+template <std::uint32_t Bits>
+void unpack(const std::uint64_t* in, std::uint32_t* out) noexcept {
+  if constexpr (Bits == 0u) {
+    std::fill(out, out + kBlock, 0u);
+  } else {
+    constexpr std::uint64_t mask = (1ull << Bits) - 1ull;
+    for (std::size_t i = 0ull; i < kBlock; ++i) {
+      const std::size_t bit = i * Bits;
+      const std::size_t shift = bit % kWordBits;
+      std::uint64_t value = in[bit / kWordBits] >> shift;
+      if (shift + Bits > kWordBits)
+        value |= in[bit / kWordBits + 1ull] << (kWordBits - shift);
+      out[i] = static_cast<std::uint32_t>(value & mask);
+    }
+  }
+}
+
+using Unpacker = void (*)(const std::uint64_t*, std::uint32_t*) noexcept;
+
+template <std::uint32_t... Bits>
+constexpr std::array<Unpacker, sizeof...(Bits)> unpackers(
+    std::integer_sequence<std::uint32_t, Bits...>) noexcept {
+  return {&unpack<Bits>...};
+}
+
+inline void unpack(const std::uint64_t* in, std::uint32_t bits,
+                   std::uint32_t* out) noexcept {
+  static constexpr auto table =
+      unpackers(std::make_integer_sequence<std::uint32_t, 33u>());
+  table[bits](in, out);
+}
+
+}  // namespace CompressedDetail
+
+// Forward iterator over CompressedVector: decodes a block at a time into
+// its own buffer, so going through all the values costs one unpacking per
+// 128 of them. Gives values, not references
+template <typename CompressedVector>
+class CompressedVectorIterator {
+ public:
+  using difference_type = std::ptrdiff_t;
+  using value_type = std::uint32_t;
+  using pointer = void;
+  using reference = std::uint32_t;
+  using iterator_category = std::forward_iterator_tag;
+
+ private:
+  const CompressedVector* vector_;
+  std::size_t index_;
+  std::uint32_t buffer_[CompressedDetail::kBlock];
+
+ public:
+  CompressedVectorIterator(const CompressedVector* vector,
+                           std::size_t index) noexcept
+      : vector_{vector}, index_{index} {
+    if (index_ < vector_->Size()) load();
+  }
+
+  reference operator*() const noexcept {
+    return buffer_[index_ % CompressedDetail::kBlock];
+  }
+  std::size_t Index() const noexcept { return index_; }
+
+  CompressedVectorIterator& operator++() noexcept {
+    ++index_;
+    if (index_ % CompressedDetail::kBlock == 0ull && index_ < vector_->Size())
+      load();
+    return *this;
+  }
+  CompressedVectorIterator operator++(int) noexcept {
+    CompressedVectorIterator temporary(*this);
+    ++*this;
+    return temporary;
+  }
+
+  bool operator==(const CompressedVectorIterator& other) const noexcept {
+    return index_ == other.index_;
+  }
+  bool operator!=(const CompressedVectorIterator& other) const noexcept {
+    return index_ != other.index_;
+  }
+
+ private:
+  void load() noexcept {
+    vector_->decodeBlock(index_ / CompressedDetail::kBlock, buffer_);
+  }
+};
+
+// Read-mostly vector of 32-bit integers compressed in blocks of 128: codec
+// makes small residuals of the values, which are bit-packed with the width
+// of the largest of them. A skip table of the blocks keeps where each one
+// starts, so operator[] unpacks one residual (FrameOfReference) or one
+// block (Delta); the last incomplete block is kept as it is. Only appending
+// is supported
+template <typename CodecPolicy = Codec::FrameOfReference>
+class CompressedVector {
+ public:
+  using value_type = std::uint32_t;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using codec = CodecPolicy;
+
+  using const_iterator = CompressedVectorIterator<CompressedVector>;
+  using iterator = const_iterator;
+
+  friend const_iterator;  // to decode blocks
+
+  static constexpr size_type kBlock = CompressedDetail::kBlock;
+
+ private:
+  // a skip table entry
+  struct Block {
+    size_type offset;  // the first word in words_
+    std::uint32_t base;
+    std::uint32_t bits;
+  };
+
+  Vector<Block> blocks_;
+  Vector<std::uint64_t> words_;
+  Vector<std::uint32_t> tail_;  // not yet full block
+
+ public:
+  CompressedVector() = default;
+  CompressedVector(std::initializer_list<value_type> list)
+      : CompressedVector(list.begin(), list.end()) {}
+  template <typename InputIt,
+            typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+  CompressedVector(InputIt first, InputIt last) {
+    for (; first != last; ++first) Push_back(*first);
+    Shrink_to_fit();
+  }
+  template <typename Container,
+            typename = decltype(std::declval<const Container&>().Data())>
+  explicit CompressedVector(const Container& values) {
+    Reserve(values.Size());
+    for (size_type i = 0ull; i < values.Size(); ++i) Push_back(values[i]);
+    Shrink_to_fit();
+  }
+
+  size_type Size() const noexcept {
+    return blocks_.Size() * kBlock + tail_.Size();
+  }
+  bool Empty() const noexcept { return !Size(); }
+  // bytes allocated for the values, the skip table included
+  size_type Memory() const noexcept {
+    return words_.Capacity() * sizeof(std::uint64_t) +
+           blocks_.Capacity() * sizeof(Block) +
+           tail_.Capacity() * sizeof(std::uint32_t);
+  }
+
+  // the skip table for count values; the packed words are not reserved, as
+  // their number is not known before the values are
+  void Reserve(size_type count) {
+    blocks_.Reserve(count / kBlock);
+    tail_.Reserve(kBlock);
+  }
+  void Shrink_to_fit() {
+    blocks_.Shrink_to_fit();
+    words_.Shrink_to_fit();
+    tail_.Shrink_to_fit();
+  }
+  void Clear() {
+    blocks_.Clear();
+    words_.Clear();
+    tail_.Clear();
+  }
+  void Swap(CompressedVector& other) noexcept {
+    std::swap(blocks_, other.blocks_);
+    std::swap(words_, other.words_);
+    std::swap(tail_, other.tail_);
+  }
+
+  // with Codec::Delta the values should not decrease
+  void Push_back(value_type value) {
+    assert((CodecPolicy::kRandomAccess || Empty() || Back() <= value) &&
+           "Values are not sorted!");
+    tail_.Push_back(value);
+    if (tail_.Size() == kBlock) flush();
+  }
+
+  value_type operator[](size_type pos) const {
+    const size_type block = pos / kBlock;
+    const size_type index = pos % kBlock;
+    if (block == blocks_.Size()) return tail_[index];
+    if constexpr (CodecPolicy::kRandomAccess) {
+      const Block& header = blocks_[block];
+      return header.base +
+             CompressedDetail::unpackOne(words_.Data() + header.offset,
+                                         header.bits, index);
+    } else {
+      std::uint32_t values[kBlock];
+      decodeBlock(block, values);
+      return values[index];
+    }
+  }
+  value_type At(size_type pos) const {
+    if (pos >= Size()) throw std::out_of_range("Index is out of range!");
+    return operator[](pos);
+  }
+  value_type Front() const { return operator[](0ull); }
+  value_type Back() const {
+    return tail_.Empty() ? operator[](Size() - 1ull) : tail_.Back();
+  }
+
+  const_iterator begin() const noexcept { return cbegin(); }
+  const_iterator cbegin() const noexcept { return const_iterator(this, 0ull); }
+  const_iterator end() const noexcept { return cend(); }
+  const_iterator cend() const noexcept {
+    return const_iterator(this, Size());
+  }
+
+  // all the values, unpacked block by block straight into the result
+  Vector<value_type> Decompress() const {
+    Vector<value_type> result;
+    result.Resize_default_init(Size());
+    for (size_type block = 0ull; block < blocks_.Size(); ++block)
+      decodeBlock(block, result.Data() + block * kBlock);
+    std::copy(tail_.Data(), tail_.Data() + tail_.Size(),
+              result.Data() + blocks_.Size() * kBlock);
+    return result;
+  }
+
+ private:
+  void flush() {
+    std::uint32_t residuals[kBlock];
+    const std::uint32_t base =
+        CodecPolicy::Encode(tail_.Data(), residuals, kBlock);
+    const std::uint32_t bits = CompressedDetail::bitWidth(residuals);
+    const size_type offset = words_.Size();
+
+    blocks_.Push_back({offset, base, bits});
+    try {
+      words_.Resize(offset + CompressedDetail::words(bits));
+    } catch (...) {
+      blocks_.Pop_back();
+      throw;
+    }
+    CompressedDetail::pack(residuals, bits, words_.Data() + offset);
+    tail_.Resize(0ull);  // keeps the memory for the next block
+  }
+
+  // the values of a full block or of the tail
+  void decodeBlock(size_type block, std::uint32_t* out) const noexcept {
+    if (block == blocks_.Size()) {
+      std::copy(tail_.Data(), tail_.Data() + tail_.Size(), out);
+      return;
+    }
+    const Block& header = blocks_[block];
+    CompressedDetail::unpack(words_.Data() + header.offset, header.bits, out);
+    CodecPolicy::Decode(header.base, out, kBlock);
+  }
+};
+
+template <typename CodecPolicy>
+bool operator==(const CompressedVector<CodecPolicy>& left,
+                const CompressedVector<CodecPolicy>& right) {
+  return left.Size() == right.Size() &&
+         std::equal(left.begin(), left.end(), right.begin());
+}
+
+template <typename CodecPolicy>
+bool operator!=(const CompressedVector<CodecPolicy>& left,
+                const CompressedVector<CodecPolicy>& right) {
+  return !(left == right);
+}
+
+}  // namespace s21
+
+#endif  //  _S21_COMPRESSED_VECTOR_H_
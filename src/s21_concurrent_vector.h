@@ -0,0 +1,293 @@
+#ifndef _S21_CONCURRENT_VECTOR_H_
+#define _S21_CONCURRENT_VECTOR_H_
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+#include "s21_segmented_vector.h"
+#include "s21_utility.h"
+
+namespace s21 {
+
+// Append-only vector for many writers at once. Push_back takes its slot with
+// one fetch-add and constructs the element there. The elements are kept in
+// blocks like in SegmentedVector, a missing block is allocated once by
+// whoever needs it first while the other writers which need it spin, so
+// growing never moves anything and never stops the readers. Each block has
+// a bitmap of the constructed elements, one bit each; an element may be
+// read by any thread once Ready(pos) is true. Slots below Size() may still
+// be under construction: copying and comparing take the elements up to the
+// first one which is not Ready, iterate or Clear only when the writers are
+// done
+template <typename Type, std::size_t FirstBlock = 16ull,
+          typename Allocator = std::allocator<Type>>
+class ConcurrentVector : private Utility::AllocatorHolder<Allocator> {
+  using traits = std::allocator_traits<Allocator>;
+  using layout = Utility::GeometricBlocks<FirstBlock>;
+
+  using word_type = std::atomic<std::uint64_t>;
+  using word_allocator_type = typename traits::template rebind_alloc<word_type>;
+  using word_traits = std::allocator_traits<word_allocator_type>;
+  static constexpr std::size_t kWordBits = 64ull;
+
+ public:
+  using allocator_type = Allocator;
+  using value_type = Type;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using pointer = value_type*;
+  using const_pointer = const value_type*;
+
+  using iterator = SegmentedVectorIterator<ConcurrentVector>;
+  using const_iterator =
+      SegmentedVectorIterator<ConcurrentVector, const_pointer, const_reference>;
+
+ private:
+  // the bitmap of a block is published before the block itself
+  std::atomic<pointer> blocks_[layout::kMaxBlocks];
+  std::atomic<word_type*> ready_[layout::kMaxBlocks];
+  std::atomic<bool> allocating_[layout::kMaxBlocks];
+  std::atomic<size_type> size_;  // slots handed out to the writers
+
+ public:
+  ConcurrentVector() noexcept(noexcept(Allocator())) : size_{0ull} {
+    initialize();
+  }
+  explicit ConcurrentVector(const Allocator& allocator) noexcept
+      : Utility::AllocatorHolder<Allocator>(allocator), size_{0ull} {
+    initialize();
+  }
+
+  ConcurrentVector(std::initializer_list<value_type> list,
+                   const Allocator& allocator = Allocator())
+      : ConcurrentVector(allocator) {
+    for (const auto& element : list) Push_back(element);
+  }
+
+  ConcurrentVector(const ConcurrentVector& other)
+      : ConcurrentVector(traits::select_on_container_copy_construction(
+            other.allocator())) {
+    for (size_type i = 0ull; other.Ready(i); ++i) Push_back(other[i]);
+  }
+  ConcurrentVector(ConcurrentVector&& other) noexcept
+      : ConcurrentVector(other.allocator()) {
+    Swap(other);
+  }
+
+  ConcurrentVector& operator=(const ConcurrentVector& other) {
+    if (this == &other) return *this;
+
+    ConcurrentVector temporary(other);
+    Swap(temporary);
+    return *this;
+  }
+  ConcurrentVector& operator=(ConcurrentVector&& other) noexcept {
+    if (this == &other) return *this;
+
+    Clear();
+    if constexpr (traits::propagate_on_container_move_assignment::value)
+      this->allocator() = std::move(other.allocator());
+    assert(this->allocator() == other.allocator() &&
+           "Moving vectors with unequal allocators!");
+    Swap(other);
+    return *this;
+  }
+
+  ~ConcurrentVector() { Clear(); }
+
+  allocator_type Get_allocator() const noexcept { return this->allocator(); }
+
+  reference operator[](size_type pos) { return *element(pos); }
+  const_reference operator[](size_type pos) const { return *element(pos); }
+
+  reference At(size_type pos) {
+    if (!Ready(pos)) throw std::out_of_range("Index is out of range!");
+    return operator[](pos);
+  }
+  const_reference At(size_type pos) const {
+    if (!Ready(pos)) throw std::out_of_range("Index is out of range!");
+    return operator[](pos);
+  }
+
+  // the element is constructed and its writes are seen by the caller
+  bool Ready(size_type pos) const noexcept {
+    if (pos >= Size()) return false;
+    const size_type k = layout::Block(pos);
+    if (!blocks_[k].load(std::memory_order_acquire)) return false;
+    return ready(ready_[k].load(std::memory_order_relaxed),
+                 layout::Offset(pos));
+  }
+
+  size_type Size() const noexcept {
+    return size_.load(std::memory_order_acquire);
+  }
+  bool Empty() const noexcept { return !Size(); }
+
+  iterator begin() noexcept { return iterator(this, 0ull); }
+  const_iterator begin() const noexcept { return cbegin(); }
+  const_iterator cbegin() const noexcept { return const_iterator(this, 0ull); }
+  iterator end() noexcept { return iterator(this, Size()); }
+  const_iterator end() const noexcept { return cend(); }
+  const_iterator cend() const noexcept { return const_iterator(this, Size()); }
+
+  void Push_back(const_reference value) { Emplace_back(value); }
+  void Push_back(value_type&& value) { Emplace_back(std::move(value)); }
+
+  // safe to call from many threads at once. If the element can not be
+  // constructed, the slot stays taken and never becomes Ready
+  template <typename... Args>
+  reference Emplace_back(Args&&... args) {
+    const size_type index = size_.fetch_add(1ull, std::memory_order_acq_rel);
+    const size_type k = layout::Block(index);
+    const size_type offset = layout::Offset(index);
+    pointer place = block(k) + offset;
+    traits::construct(this->allocator(), place, std::forward<Args>(args)...);
+    ready_[k]
+        .load(std::memory_order_relaxed)[offset / kWordBits]
+        .fetch_or(1ull << (offset % kWordBits), std::memory_order_release);
+    return *place;
+  }
+
+  // safe to call along with Push_back
+  void Reserve(size_type new_capacity) {
+    for (size_type k = 0ull; layout::Start(k) < new_capacity; ++k) block(k);
+  }
+
+  void Clear() noexcept {
+    const size_type size = Size();
+    for (size_type k = 0ull; k < layout::kMaxBlocks; ++k) {
+      pointer elements = blocks_[k].load(std::memory_order_acquire);
+      if (!elements) continue;
+
+      word_type* bits = ready_[k].load(std::memory_order_relaxed);
+      for (size_type i = 0ull; i < layout::Size(k); ++i)
+        if (layout::Start(k) + i < size && ready(bits, i))
+          traits::destroy(this->allocator(), elements + i);
+      deallocateBlock(elements, bits, k);
+      blocks_[k].store(nullptr, std::memory_order_release);
+      ready_[k].store(nullptr, std::memory_order_relaxed);
+    }
+    size_.store(0ull, std::memory_order_release);
+  }
+
+  // not to be called with the writers running
+  void Swap(ConcurrentVector& other) noexcept {
+    if (this == &other) return;
+    using std::swap;  // to enable ADL
+    if constexpr (traits::propagate_on_container_swap::value)
+      swap(this->allocator(), other.allocator());
+    else
+      assert(this->allocator() == other.allocator() &&
+             "Swapping vectors with unequal allocators!");
+    for (size_type k = 0ull; k < layout::kMaxBlocks; ++k) {
+      blocks_[k].store(other.blocks_[k].exchange(blocks_[k].load()));
+      ready_[k].store(other.ready_[k].exchange(ready_[k].load()));
+    }
+    size_.store(other.size_.exchange(size_.load()));
+  }
+
+ private:
+  void initialize() noexcept {
+    for (size_type k = 0ull; k < layout::kMaxBlocks; ++k) {
+      blocks_[k].store(nullptr);
+      ready_[k].store(nullptr);
+      allocating_[k].store(false);
+    }
+  }
+
+  static size_type words(size_type k) noexcept {
+    return (layout::Size(k) + kWordBits - 1ull) / kWordBits;
+  }
+
+  // the bit of the element at offset in its block is set
+  static bool ready(const word_type* bits, size_type offset) noexcept {
+    return bits[offset / kWordBits].load(std::memory_order_acquire) >>
+               (offset % kWordBits) &
+           1ull;
+  }
+
+  pointer element(size_type pos) const noexcept {
+    assert(Ready(pos) && "The element is not constructed yet!");
+    return blocks_[layout::Block(pos)].load(std::memory_order_acquire) +
+           layout::Offset(pos);
+  }
+
+  // gives block k allocating it when it is not there yet: the first writer
+  // allocates, the others spin until it is done. When the allocation
+  // throws, the block stays missing for the next one to try
+  pointer block(size_type k) {
+    pointer elements = blocks_[k].load(std::memory_order_acquire);
+    if (elements) return elements;
+
+    while (allocating_[k].exchange(true, std::memory_order_acquire))
+      while (allocating_[k].load(std::memory_order_relaxed))
+        std::this_thread::yield();
+
+    elements = blocks_[k].load(std::memory_order_acquire);
+    if (!elements) {
+      try {
+        elements = allocateBlock(k);
+      } catch (...) {
+        allocating_[k].store(false, std::memory_order_release);
+        throw;
+      }
+    }
+    allocating_[k].store(false, std::memory_order_release);
+    return elements;
+  }
+
+  pointer allocateBlock(size_type k) {
+    word_allocator_type word_allocator(this->allocator());
+    word_type* bits = word_traits::allocate(word_allocator, words(k));
+    pointer elements = nullptr;
+    try {
+      elements = traits::allocate(this->allocator(), layout::Size(k));
+    } catch (...) {
+      word_traits::deallocate(word_allocator, bits, words(k));
+      throw;
+    }
+    for (size_type i = 0ull; i < words(k); ++i)
+      ::new (static_cast<void*>(bits + i)) word_type(0ull);
+
+    ready_[k].store(bits, std::memory_order_relaxed);
+    blocks_[k].store(elements, std::memory_order_release);
+    return elements;
+  }
+
+  void deallocateBlock(pointer elements, word_type* bits,
+                       size_type k) noexcept {
+    traits::deallocate(this->allocator(), elements, layout::Size(k));
+    word_allocator_type word_allocator(this->allocator());
+    word_traits::deallocate(word_allocator, bits, words(k));
+  }
+};
+
+template <typename Type, std::size_t FirstBlock, typename Allocator>
+bool operator==(const ConcurrentVector<Type, FirstBlock, Allocator>& left,
+                const ConcurrentVector<Type, FirstBlock, Allocator>& right) {
+  std::size_t i = 0ull;
+  for (; left.Ready(i) && right.Ready(i); ++i)
+    if (left[i] != right[i]) return false;
+
+  return !left.Ready(i) && !right.Ready(i);
+}
+
+template <typename Type, std::size_t FirstBlock, typename Allocator>
+bool operator!=(const ConcurrentVector<Type, FirstBlock, Allocator>& left,
+                const ConcurrentVector<Type, FirstBlock, Allocator>& right) {
+  return !(left == right);
+}
+
+}  // namespace s21
+
+#endif  //  _S21_CONCURRENT_VECTOR_H_
@@ -2,7 +2,14 @@
 #define _S21_CONTAINERSPLUS_H_
 
 #include "s21_array.h"
+#include "s21_bitset.h"
+#include "s21_compressed_vector.h"
+#include "s21_concurrent_vector.h"
+#include "s21_flat_map.h"
 #include "s21_multimap.h"
 #include "s21_multiset.h"
+#include "s21_segmented_vector.h"
+#include "s21_small_vector.h"
+#include "s21_soa_vector.h"
 
 #endif  //  _S21_CONTAINERSPLUS_H_
@@ -0,0 +1,551 @@
+#ifndef _S21_FLAT_MAP_H_
+#define _S21_FLAT_MAP_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_sort.h"
+#include "s21_utility.h"
+#include "s21_vector.h"
+
+namespace s21 {
+
+// FlatSet and FlatMap: the keys are kept sorted in a Vector, searched by
+// binary search. No nodes, so they take a Vector worth of memory and a
+// lookup touches only keys; an insertion or erasure in the middle shifts
+// the elements after it, so bulk data should go through the constructors
+// or the Insert of a range, which sort the new elements once and merge
+// them in. Iterators are invalidated by every modification
+
+namespace FlatDetail {
+
+// sorts keys keeping equal ones in their order and leaves only the first
+// of them, like inserting one by one would do
+template <typename Type, typename Comparator, typename Projection>
+void sortUnique(Vector<Type>& elements, const Comparator& comparator,
+                Projection projection) {
+  Stable_sort(elements.Data(), elements.Data() + elements.Size(), comparator,
+              projection);
+  auto* end = std::unique(elements.Data(), elements.Data() + elements.Size(),
+                          [&](const Type& left, const Type& right) {
+                            return !comparator(std::invoke(projection, left),
+                                               std::invoke(projection, right));
+                          });
+  elements.Erase(elements.cbegin() + (end - elements.Data()), elements.cend());
+}
+
+}  // namespace FlatDetail
+
+template <typename Key, typename Comparator = Utility::Less<Key>>
+class FlatSet {
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = const Key&;
+  using const_reference = const Key&;
+  using comparator = Comparator;
+
+  // keys are not to be changed in place
+  using iterator = typename Vector<Key>::const_iterator;
+  using const_iterator = iterator;
+
+ private:
+  Vector<Key> keys_;
+  comparator comparator_;
+
+ public:
+  FlatSet() = default;
+  explicit FlatSet(const comparator& compare) : comparator_{compare} {}
+  // keys in any order, repeated ones are dropped
+  explicit FlatSet(Vector<Key>&& keys, const comparator& compare = comparator())
+      : keys_{std::move(keys)}, comparator_{compare} {
+    FlatDetail::sortUnique(keys_, comparator_, Utility::Identity());
+  }
+  template <typename InputIt,
+            typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+  FlatSet(InputIt first, InputIt last, const comparator& compare = comparator())
+      : FlatSet(Vector<Key>(first, last), compare) {}
+  FlatSet(std::initializer_list<Key> list,
+          const comparator& compare = comparator())
+      : FlatSet(list.begin(), list.end(), compare) {}
+
+  bool Empty() const noexcept { return keys_.Empty(); }
+  size_type Size() const noexcept { return keys_.Size(); }
+  size_type Capacity() const noexcept { return keys_.Capacity(); }
+  void Reserve(size_type new_capacity) { keys_.Reserve(new_capacity); }
+  void Shrink_to_fit() { keys_.Shrink_to_fit(); }
+  void Clear() { keys_.Clear(); }
+  void Swap(FlatSet& other) noexcept {
+    std::swap(keys_, other.keys_);
+    std::swap(comparator_, other.comparator_);
+  }
+
+  // the sorted keys
+  const Vector<Key>& Keys() const noexcept { return keys_; }
+
+  const_iterator begin() const { return keys_.cbegin(); }
+  const_iterator cbegin() const { return keys_.cbegin(); }
+  const_iterator end() const { return keys_.cend(); }
+  const_iterator cend() const { return keys_.cend(); }
+
+  std::pair<iterator, bool> Insert(const Key& key) { return emplace(key); }
+  std::pair<iterator, bool> Insert(Key&& key) {
+    return emplace(std::move(key));
+  }
+  // the keys are sorted apart and merged in: O(n + m log m) for m keys
+  template <typename InputIt,
+            typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+  void Insert(InputIt first, InputIt last) {
+    merge(FlatSet(first, last, comparator_));
+  }
+  void Insert(std::initializer_list<Key> list) {
+    Insert(list.begin(), list.end());
+  }
+  // the keys of other which are not here
+  void Merge(FlatSet&& other) { merge(std::move(other)); }
+
+  iterator Erase(const_iterator pos) {
+    const difference_type index = pos - cbegin();
+    keys_.Erase(pos);
+    return cbegin() + index;
+  }
+  iterator Erase(const_iterator first, const_iterator last) {
+    const difference_type index = first - cbegin();
+    keys_.Erase(first, last);
+    return cbegin() + index;
+  }
+  size_type Erase(const Key& key) {
+    const size_type pos = find(key);
+    if (pos == Size()) return 0ull;
+    keys_.Erase(keys_.cbegin() + pos);
+    return 1ull;
+  }
+
+  const_iterator Find(const Key& key) const { return cbegin() + find(key); }
+  bool Contains(const Key& key) const { return find(key) != Size(); }
+  size_type Count(const Key& key) const { return Contains(key); }
+  const_iterator Lower_bound(const Key& key) const {
+    return cbegin() + lowerBound(key);
+  }
+  const_iterator Upper_bound(const Key& key) const {
+    return cbegin() + upperBound(key);
+  }
+  std::pair<const_iterator, const_iterator> Equal_range(const Key& key) const {
+    return {Lower_bound(key), Upper_bound(key)};
+  }
+
+ private:
+  size_type lowerBound(const Key& key) const {
+    return static_cast<size_type>(
+        std::lower_bound(keys_.Data(), keys_.Data() + Size(), key,
+                         comparator_) -
+        keys_.Data());
+  }
+  size_type upperBound(const Key& key) const {
+    return static_cast<size_type>(
+        std::upper_bound(keys_.Data(), keys_.Data() + Size(), key,
+                         comparator_) -
+        keys_.Data());
+  }
+  // the position of key or Size()
+  size_type find(const Key& key) const {
+    const size_type pos = lowerBound(key);
+    return pos != Size() && !comparator_(key, keys_[pos]) ? pos : Size();
+  }
+
+  template <typename Argument>
+  std::pair<iterator, bool> emplace(Argument&& key) {
+    const size_type pos = lowerBound(key);
+    if (pos != Size() && !comparator_(key, keys_[pos]))
+      return {cbegin() + pos, false};
+    keys_.Insert(keys_.cbegin() + pos, std::forward<Argument>(key));
+    return {cbegin() + pos, true};
+  }
+
+  // keys of both in one pass into a new Vector, ours win over equal ones
+  void merge(FlatSet&& other) {
+    if (other.Empty()) return;
+    if (Empty()) {
+      keys_ = std::move(other.keys_);
+      return;
+    }
+
+    Vector<Key> result;
+    result.Reserve(Size() + other.Size());
+    size_type i = 0ull;
+    size_type j = 0ull;
+    while (i < Size() && j < other.Size()) {
+      if (comparator_(other.keys_[j], keys_[i])) {
+        result.Push_back(std::move(other.keys_[j++]));
+      } else {
+        if (!comparator_(keys_[i], other.keys_[j])) ++j;
+        result.Push_back(std::move(keys_[i++]));
+      }
+    }
+    for (; i < Size(); ++i) result.Push_back(std::move(keys_[i]));
+    for (; j < other.Size(); ++j) result.Push_back(std::move(other.keys_[j]));
+    keys_ = std::move(result);
+    other.Clear();
+  }
+};
+
+// Iterator over FlatMap: a key and a value pointer moving together.
+// Dereferencing gives a pair of references
+template <typename Key, typename Value>
+class FlatMapIterator {
+ public:
+  using difference_type = std::ptrdiff_t;
+  using value_type = std::pair<Key, std::remove_const_t<Value>>;
+  using reference = std::pair<const Key&, Value&>;
+  using iterator_category = std::random_access_iterator_tag;
+
+  // for it->second: keeps the pair of references it points to
+  class pointer {
+   public:
+    explicit pointer(reference pair) noexcept : pair_{pair} {}
+    reference* operator->() noexcept { return &pair_; }
+
+   private:
+    reference pair_;
+  };
+
+  template <typename KeyType, typename ValueType>
+  friend class FlatMapIterator;  // to compare const_iterator with iterator
+
+ private:
+  const Key* key_;
+  Value* value_;
+
+ public:
+  FlatMapIterator(const Key* key, Value* value) noexcept
+      : key_{key}, value_{value} {}
+  // iterator converts to const_iterator
+  template <typename ValueType,
+            typename = std::enable_if_t<std::is_convertible_v<ValueType*,
+                                                              Value*>>>
+  FlatMapIterator(const FlatMapIterator<Key, ValueType>& other) noexcept
+      : key_{other.key_}, value_{other.value_} {}
+
+  reference operator*() const noexcept { return {*key_, *value_}; }
+  pointer operator->() const noexcept { return pointer(**this); }
+  reference operator[](difference_type n) const noexcept {
+    return {key_[n], value_[n]};
+  }
+
+  FlatMapIterator& operator++() noexcept { return *this += 1; }
+  FlatMapIterator operator++(int) noexcept {
+    FlatMapIterator temporary(*this);
+    ++*this;
+    return temporary;
+  }
+  FlatMapIterator& operator--() noexcept { return *this -= 1; }
+  FlatMapIterator operator--(int) noexcept {
+    FlatMapIterator temporary(*this);
+    --*this;
+    return temporary;
+  }
+
+  FlatMapIterator& operator+=(difference_type n) noexcept {
+    key_ += n;
+    value_ += n;
+    return *this;
+  }
+  FlatMapIterator& operator-=(difference_type n) noexcept {
+    return *this += -n;
+  }
+  FlatMapIterator operator+(difference_type n) const noexcept {
+    return FlatMapIterator(key_ + n, value_ + n);
+  }
+  FlatMapIterator operator-(difference_type n) const noexcept {
+    return FlatMapIterator(key_ - n, value_ - n);
+  }
+  template <typename ValueType>
+  difference_type operator-(
+      const FlatMapIterator<Key, ValueType>& other) const noexcept {
+    return key_ - other.key_;
+  }
+
+  template <typename ValueType>
+  bool operator==(const FlatMapIterator<Key, ValueType>& other) const noexcept {
+    return key_ == other.key_;
+  }
+  template <typename ValueType>
+  bool operator!=(const FlatMapIterator<Key, ValueType>& other) const noexcept {
+    return key_ != other.key_;
+  }
+  template <typename ValueType>
+  bool operator<(const FlatMapIterator<Key, ValueType>& other) const noexcept {
+    return key_ < other.key_;
+  }
+};
+
+// Keys and values live in two Vectors side by side, so a lookup reads only
+// keys; Keys() and Values() give them as they are
+template <typename Key, typename Value,
+          typename Comparator = Utility::Less<Key>>
+class FlatMap {
+  static_assert(!std::is_same_v<Value, bool>,
+                "Vector<bool> is packed into bits, use std::uint8_t!");
+
+ public:
+  using key_type = Key;
+  using mapped_type = Value;
+  using value_type = std::pair<Key, Value>;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using comparator = Comparator;
+
+  using iterator = FlatMapIterator<Key, Value>;
+  using const_iterator = FlatMapIterator<Key, const Value>;
+
+ private:
+  Vector<Key> keys_;
+  Vector<Value> values_;
+  comparator comparator_;
+
+ public:
+  FlatMap() = default;
+  explicit FlatMap(const comparator& compare) : comparator_{compare} {}
+  // pairs in any order, of equal keys the first one is kept
+  explicit FlatMap(Vector<value_type>&& pairs,
+                   const comparator& compare = comparator())
+      : comparator_{compare} {
+    FlatDetail::sortUnique(pairs, comparator_, &value_type::first);
+    keys_.Reserve(pairs.Size());
+    values_.Reserve(pairs.Size());
+    for (auto& [key, value] : pairs) {
+      keys_.Push_back(std::move(key));
+      values_.Push_back(std::move(value));
+    }
+  }
+  template <typename InputIt,
+            typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+  FlatMap(InputIt first, InputIt last, const comparator& compare = comparator())
+      : FlatMap(Vector<value_type>(first, last), compare) {}
+  FlatMap(std::initializer_list<value_type> list,
+          const comparator& compare = comparator())
+      : FlatMap(list.begin(), list.end(), compare) {}
+
+  bool Empty() const noexcept { return keys_.Empty(); }
+  size_type Size() const noexcept { return keys_.Size(); }
+  size_type Capacity() const noexcept {
+    return std::min(keys_.Capacity(), values_.Capacity());
+  }
+  void Reserve(size_type new_capacity) {
+    keys_.Reserve(new_capacity);
+    values_.Reserve(new_capacity);
+  }
+  void Shrink_to_fit() {
+    keys_.Shrink_to_fit();
+    values_.Shrink_to_fit();
+  }
+  void Clear() {
+    keys_.Clear();
+    values_.Clear();
+  }
+  void Swap(FlatMap& other) noexcept {
+    std::swap(keys_, other.keys_);
+    std::swap(values_, other.values_);
+    std::swap(comparator_, other.comparator_);
+  }
+
+  // the sorted keys and their values at the same positions
+  const Vector<Key>& Keys() const noexcept { return keys_; }
+  const Vector<Value>& Values() const noexcept { return values_; }
+
+  iterator begin() { return at(0ull); }
+  const_iterator begin() const { return cbegin(); }
+  const_iterator cbegin() const { return at(0ull); }
+  iterator end() { return at(Size()); }
+  const_iterator end() const { return cend(); }
+  const_iterator cend() const { return at(Size()); }
+
+  Value& operator[](const Key& key) { return emplace(key).first->second; }
+  Value& operator[](Key&& key) {
+    return emplace(std::move(key)).first->second;
+  }
+  Value& At(const Key& key) {
+    const size_type pos = find(key);
+    if (pos == Size()) throw std::out_of_range("Not found in map!");
+    return values_[pos];
+  }
+  const Value& At(const Key& key) const {
+    const size_type pos = find(key);
+    if (pos == Size()) throw std::out_of_range("Not found in map!");
+    return values_[pos];
+  }
+
+  std::pair<iterator, bool> Insert(const value_type& pair) {
+    return emplace(pair.first, pair.second);
+  }
+  std::pair<iterator, bool> Insert(value_type&& pair) {
+    return emplace(std::move(pair.first), std::move(pair.second));
+  }
+  // the value of an existing key is assigned
+  template <typename Argument>
+  std::pair<iterator, bool> Insert_or_assign(const Key& key,
+                                             Argument&& value) {
+    auto result = emplace(key, std::forward<Argument>(value));
+    if (!result.second) result.first->second = std::forward<Argument>(value);
+    return result;
+  }
+  // the pairs are sorted apart and merged in: O(n + m log m) for m pairs
+  template <typename InputIt,
+            typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+  void Insert(InputIt first, InputIt last) {
+    merge(FlatMap(first, last, comparator_));
+  }
+  void Insert(std::initializer_list<value_type> list) {
+    Insert(list.begin(), list.end());
+  }
+  // the pairs of other whose keys are not here
+  void Merge(FlatMap&& other) { merge(std::move(other)); }
+
+  iterator Erase(const_iterator pos) {
+    const size_type index = static_cast<size_type>(pos - cbegin());
+    keys_.Erase(keys_.cbegin() + index);
+    values_.Erase(values_.cbegin() + index);
+    return at(index);
+  }
+  iterator Erase(const_iterator first, const_iterator last) {
+    const size_type from = static_cast<size_type>(first - cbegin());
+    const size_type to = static_cast<size_type>(last - cbegin());
+    keys_.Erase(keys_.cbegin() + from, keys_.cbegin() + to);
+    values_.Erase(values_.cbegin() + from, values_.cbegin() + to);
+    return at(from);
+  }
+  size_type Erase(const Key& key) {
+    const size_type pos = find(key);
+    if (pos == Size()) return 0ull;
+    Erase(cbegin() + pos);
+    return 1ull;
+  }
+
+  iterator Find(const Key& key) { return at(find(key)); }
+  const_iterator Find(const Key& key) const { return at(find(key)); }
+  bool Contains(const Key& key) const { return find(key) != Size(); }
+  size_type Count(const Key& key) const { return Contains(key); }
+  iterator Lower_bound(const Key& key) { return at(lowerBound(key)); }
+  const_iterator Lower_bound(const Key& key) const {
+    return at(lowerBound(key));
+  }
+  iterator Upper_bound(const Key& key) { return at(upperBound(key)); }
+  const_iterator Upper_bound(const Key& key) const {
+    return at(upperBound(key));
+  }
+  std::pair<iterator, iterator> Equal_range(const Key& key) {
+    return {Lower_bound(key), Upper_bound(key)};
+  }
+  std::pair<const_iterator, const_iterator> Equal_range(const Key& key) const {
+    return {Lower_bound(key), Upper_bound(key)};
+  }
+
+ private:
+  iterator at(size_type pos) {
+    return iterator(keys_.Data() + pos, values_.Data() + pos);
+  }
+  const_iterator at(size_type pos) const {
+    return const_iterator(keys_.Data() + pos, values_.Data() + pos);
+  }
+
+  size_type lowerBound(const Key& key) const {
+    return static_cast<size_type>(
+        std::lower_bound(keys_.Data(), keys_.Data() + Size(), key,
+                         comparator_) -
+        keys_.Data());
+  }
+  size_type upperBound(const Key& key) const {
+    return static_cast<size_type>(
+        std::upper_bound(keys_.Data(), keys_.Data() + Size(), key,
+                         comparator_) -
+        keys_.Data());
+  }
+  // the position of key or Size()
+  size_type find(const Key& key) const {
+    const size_type pos = lowerBound(key);
+    return pos != Size() && !comparator_(key, keys_[pos]) ? pos : Size();
+  }
+
+  // a value made of args is inserted when there is no key
+  template <typename Argument, typename... Args>
+  std::pair<iterator, bool> emplace(Argument&& key, Args&&... args) {
+    const size_type pos = lowerBound(key);
+    if (pos != Size() && !comparator_(key, keys_[pos]))
+      return {at(pos), false};
+    values_.Emplace(values_.cbegin() + pos, std::forward<Args>(args)...);
+    try {
+      keys_.Insert(keys_.cbegin() + pos, std::forward<Argument>(key));
+    } catch (...) {
+      values_.Erase(values_.cbegin() + pos);
+      throw;
+    }
+    return {at(pos), true};
+  }
+
+  // pairs of both in one pass into new Vectors, ours win over equal keys
+  void merge(FlatMap&& other) {
+    if (other.Empty()) return;
+    if (Empty()) {
+      keys_ = std::move(other.keys_);
+      values_ = std::move(other.values_);
+      return;
+    }
+
+    FlatMap result(comparator_);
+    result.Reserve(Size() + other.Size());
+    auto take = [&result](FlatMap& from, size_type pos) {
+      result.keys_.Push_back(std::move(from.keys_[pos]));
+      result.values_.Push_back(std::move(from.values_[pos]));
+    };
+    size_type i = 0ull;
+    size_type j = 0ull;
+    while (i < Size() && j < other.Size()) {
+      if (comparator_(other.keys_[j], keys_[i])) {
+        take(other, j++);
+      } else {
+        if (!comparator_(keys_[i], other.keys_[j])) ++j;
+        take(*this, i++);
+      }
+    }
+    for (; i < Size(); ++i) take(*this, i);
+    for (; j < other.Size(); ++j) take(other, j);
+    Swap(result);
+    other.Clear();
+  }
+};
+
+template <typename Key, typename Comparator>
+bool operator==(const FlatSet<Key, Comparator>& left,
+                const FlatSet<Key, Comparator>& right) {
+  return left.Keys() == right.Keys();
+}
+
+template <typename Key, typename Comparator>
+bool operator!=(const FlatSet<Key, Comparator>& left,
+                const FlatSet<Key, Comparator>& right) {
+  return !(left == right);
+}
+
+template <typename Key, typename Value, typename Comparator>
+bool operator==(const FlatMap<Key, Value, Comparator>& left,
+                const FlatMap<Key, Value, Comparator>& right) {
+  return left.Keys() == right.Keys() && left.Values() == right.Values();
+}
+
+template <typename Key, typename Value, typename Comparator>
+bool operator!=(const FlatMap<Key, Value, Comparator>& left,
+                const FlatMap<Key, Value, Comparator>& right) {
+  return !(left == right);
+}
+
+}  // namespace s21
+
+#endif  //  _S21_FLAT_MAP_H_
@@ -5,6 +5,8 @@
 #include <cmath>
 #include <initializer_list>
 #include <iterator>
+#include <memory>
+#include <memory_resource>
 #include <new>
 
 #include "s21_utility.h"
@@ -198,11 +200,16 @@ class ListReverseIterator
   }
 };
 
-template <typename Type>
-class List {
+template <typename Type, typename Allocator = std::allocator<Type>>
+class List : private Utility::AllocatorHolder<Allocator> {
   struct Node;
 
+  using node_allocator_type =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+  using traits = std::allocator_traits<Allocator>;
+
  public:
+  using allocator_type = Allocator;
   using value_type = Type;
   using size_type = std::size_t;
   using difference_type = std::ptrdiff_t;
@@ -211,21 +218,23 @@ class List {
   using pointer = value_type *;
   using const_pointer = const value_type *;
   using node_pointer = Node *;
-  using node_type = Utility::Handler<node_pointer, reference>;
+  using node_type =
+      Utility::Handler<node_pointer, reference,
+                       Utility::AllocatorDelete<node_allocator_type>>;
 
  public:
-  friend class ListIterator<List<Type>>;
-  friend class ListIterator<List<Type>, const_pointer, const_reference>;
-  friend class ListReverseIterator<List<Type>>;
-  friend class ListReverseIterator<List<Type>, const_pointer, const_reference>;
+  friend class ListIterator<List>;
+  friend class ListIterator<List, const_pointer, const_reference>;
+  friend class ListReverseIterator<List>;
+  friend class ListReverseIterator<List, const_pointer, const_reference>;
 
  public:
-  using iterator = ListIterator<List<Type>>;
+  using iterator = ListIterator<List>;
   using const_iterator =
-      ListIterator<List<Type>, const_pointer, const_reference>;
-  using reverse_iterator = ListReverseIterator<List<Type>>;
+      ListIterator<List, const_pointer, const_reference>;
+  using reverse_iterator = ListReverseIterator<List>;
   using const_reverse_iterator =
-      ListReverseIterator<List<Type>, const_pointer, const_reference>;
+      ListReverseIterator<List, const_pointer, const_reference>;
 
  private:
   struct Node {
@@ -254,62 +263,106 @@ class List {
   size_type size_;
 
  public:
-  List() : end_{}, rend_{}, size_{0ull} { connect(&rend_, &end_); };
+  List() noexcept(noexcept(Allocator())) : end_{}, rend_{}, size_{0ull} {
+    connect(&rend_, &end_);
+  };
+  explicit List(const Allocator &allocator)
+      : Utility::AllocatorHolder<Allocator>(allocator),
+        end_{},
+        rend_{},
+        size_{0ull} {
+    connect(&rend_, &end_);
+  }
 
-  explicit List(size_type count) : List(count, value_type()) {}
+  explicit List(size_type count, const Allocator &allocator = Allocator())
+      : List(count, value_type(), allocator) {}
 
-  List(size_type count, const_reference value) : List() {
+  List(size_type count, const_reference value,
+       const Allocator &allocator = Allocator())
+      : List(allocator) {
     for (size_type i = 0ull; i < count; ++i) Push_back(value);
   }
 
   template <typename InputIterator>
-  List(InputIterator first, InputIterator last) : List() {
+  List(InputIterator first, InputIterator last,
+       const Allocator &allocator = Allocator())
+      : List(allocator) {
     for (auto it = first; it != last; ++it) Push_back(*it);
   }
 
-  List(const List &other) : List() {
+  List(const List &other)
+      : List(other, traits::select_on_container_copy_construction(
+                        other.allocator())) {}
+  List(const List &other, const Allocator &allocator) : List(allocator) {
     for (auto it = other.cbegin(); it != other.cend(); ++it) Push_back(*it);
   }
 
-  List(List &&other) : size_{other.size_} {
-    Node *other_first = nextOf(&(other.rend_));
-    Node *other_last = previousOf(&(other.end_));
-
-    connect(&rend_, other_first);
-    connect(other_last, &end_);
-
-    connect(&(other.rend_), &(other.end_));
-    other.size_ = 0ull;
+  List(List &&other) : List(other.allocator()) { steal(other); }
+  // nodes of other are taken only when they can be freed with the allocator,
+  // otherwise the elements are moved one by one
+  List(List &&other, const Allocator &allocator) : List(allocator) {
+    if (this->allocator() == other.allocator()) {
+      steal(other);
+      return;
+    }
+    for (auto it = other.begin(); it != other.end(); ++it)
+      Push_back(std::move(*it));
   }
 
+  // the nodes are kept when the allocator stays: their values are assigned,
+  // then the missing nodes are added or the extra ones freed. Then a
+  // throwing copy leaves a valid list with some of the values assigned
   List &operator=(const List &other) {
     if (this == &other) return *this;
 
-    List copy(other);
-    *this = std::move(copy);
+    constexpr bool propagate =
+        traits::propagate_on_container_copy_assignment::value;
+    if (!propagate || this->allocator() == other.allocator()) {
+      if constexpr (propagate) this->allocator() = other.allocator();
+      auto source = other.cbegin();
+      auto destination = begin();
+      for (; source != other.cend() && destination != end();
+           ++source, ++destination)
+        *destination = *source;
+      if (destination != end())
+        Erase(destination, cend());
+      else
+        for (; source != other.cend(); ++source) Push_back(*source);
+      return *this;
+    }
+
+    List copy(other, propagate ? other.allocator() : this->allocator());
+    Clear();
+    if constexpr (propagate) this->allocator() = copy.allocator();
+    steal(copy);
     return *this;
   }
 
   List &operator=(List &&other) {
     if (this == &other) return *this;
 
-    Clear();
-
-    size_ = other.size_;
-
-    Node *other_first = nextOf(&(other.rend_));
-    Node *other_last = previousOf(&(other.end_));
-
-    connect(&rend_, other_first);
-    connect(other_last, &end_);
+    if constexpr (!traits::propagate_on_container_move_assignment::value) {
+      if (this->allocator() != other.allocator()) {
+        List copy(std::move(other), this->allocator());
+        Clear();
+        steal(copy);
+        return *this;
+      }
+    }
 
-    connect(&(other.rend_), &(other.end_));
-    other.size_ = 0ull;
+    Clear();
+    if constexpr (traits::propagate_on_container_move_assignment::value)
+      this->allocator() = std::move(other.allocator());
+    steal(other);
 
     return *this;
   }
 
-  List(const std::initializer_list<value_type> &list) : List() {
+  allocator_type Get_allocator() const noexcept { return this->allocator(); }
+
+  List(const std::initializer_list<value_type> &list,
+       const Allocator &allocator = Allocator())
+      : List(allocator) {
     for (const auto &element : list) Push_back(element);
   };
 
@@ -373,7 +426,7 @@ class List {
     Node *old_last = previousOf(&end_);
     Node *new_last = previousOf(old_last);
 
-    delete old_last;
+    destroy_node(old_last);
     connect(new_last, &end_);
 
     --size_;
@@ -523,7 +576,7 @@ class List {
     Node *old_first = nextOf(&rend_);
     Node *new_first = nextOf(old_first);
 
-    delete old_first;
+    destroy_node(old_first);
 
     connect(&rend_, new_first);
 
@@ -531,6 +584,14 @@ class List {
   }
 
   void Swap(List &other) noexcept {
+    if constexpr (traits::propagate_on_container_swap::value) {
+      using std::swap;  // to enable ADL
+      swap(this->allocator(), other.allocator());
+    } else {
+      assert(this->allocator() == other.allocator() &&
+             "Swapping lists with unequal allocators!");
+    }
+
     Node *other_first = nextOf(&(other.rend_));
     Node *other_last = previousOf(&(other.end_));
 
@@ -575,7 +636,7 @@ class List {
     Node *previous = previousOf(pos.get());
     Node *next = nextOf(pos.get());
 
-    delete pos.get();
+    destroy_node(pos.get());
     --size_;
 
     connect(previous, next);
@@ -593,7 +654,8 @@ class List {
 
     connect(previous, next);
     --size_;
-    return node_type(pos.get());
+    return node_type(pos.get(), Utility::AllocatorDelete<node_allocator_type>(
+                                    node_allocator()));
   }
 
   template <class... Args>
@@ -650,12 +712,39 @@ class List {
     return node->next_;
   }
 
-  Node *create_node(const_reference data) { return new Node(data); }
+  node_allocator_type node_allocator() const noexcept {
+    return node_allocator_type(this->allocator());
+  }
+
+  Node *create_node(const_reference data) {
+    node_allocator_type allocator = node_allocator();
+    return Utility::Create(allocator, data);
+  }
 
-  Node *create_node(value_type &&data) { return new Node(std::move(data)); }
+  Node *create_node(value_type &&data) {
+    node_allocator_type allocator = node_allocator();
+    return Utility::Create(allocator, std::move(data));
+  }
   template <class... Args>
   Node *create_node(Args &&...args) {
-    return new Node(std::forward<Args>(args)...);
+    node_allocator_type allocator = node_allocator();
+    return Utility::Create(allocator, std::forward<Args>(args)...);
+  }
+
+  void destroy_node(Node *node) {
+    Utility::AllocatorDelete<node_allocator_type> deleter(node_allocator());
+    deleter(node);
+  }
+
+  // other is left empty, the allocators should be equal
+  void steal(List &other) noexcept {
+    if (!other.size_) return;
+    connect(&rend_, nextOf(&(other.rend_)));
+    connect(previousOf(&(other.end_)), &end_);
+    size_ = other.size_;
+
+    connect(&(other.rend_), &(other.end_));
+    other.size_ = 0ull;
   }
 
   template <typename Last>
@@ -689,8 +778,9 @@ class List {
   }
 };
 
-template <typename Type>
-bool operator==(const List<Type> &left, const List<Type> &right) {
+template <typename Type, typename Allocator>
+bool operator==(const List<Type, Allocator> &left,
+                const List<Type, Allocator> &right) {
   if (left.Size() != right.Size()) return false;
 
   auto left_iterator = left.cbegin();
@@ -705,6 +795,13 @@ bool operator==(const List<Type> &left, const List<Type> &right) {
   return true;
 }
 
+namespace pmr {
+
+template <typename Type>
+using List = s21::List<Type, std::pmr::polymorphic_allocator<Type>>;
+
+}  // namespace pmr
+
 }  // namespace s21
 
 #endif  //  _S21_LIST_H_
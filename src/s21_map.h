@@ -1,6 +1,9 @@
 #ifndef _S21_MAP_H_
 #define _S21_MAP_H_
 
+#include <memory>
+#include <memory_resource>
+
 #include "s21_tree.h"
 #include "s21_utility.h"
 
@@ -26,15 +29,18 @@ class ComparatorMap {
 }  // namespace Utility
 
 template <typename Key, typename Value,
-          typename Comparator = Utility::Less<const Key>>
+          typename Comparator = Utility::Less<const Key>,
+          typename Allocator = std::allocator<std::pair<const Key, Value>>>
 class Map : public Tree::Tree<
                 Key, std::pair<const Key, Value>,
                 Utility::ComparatorMap<const Key, std::pair<const Key, Value>,
-                                       Comparator>> {
+                                       Comparator>,
+                Allocator> {
   using Base =
       Tree::Tree<Key, std::pair<const Key, Value>,
                  Utility::ComparatorMap<const Key, std::pair<const Key, Value>,
-                                        Comparator>>;
+                                        Comparator>,
+                 Allocator>;
 
  public:
   using node_type = typename Base::node_handler;
@@ -60,9 +66,10 @@ class Map : public Tree::Tree<
   }
 };
 
-template <typename Key, typename Type>
-bool operator==(const s21::Map<Key, Type>& left,
-                const s21::Map<Key, Type>& right) {
+template <typename Key, typename Type, typename Comparator,
+          typename Allocator>
+bool operator==(const s21::Map<Key, Type, Comparator, Allocator>& left,
+                const s21::Map<Key, Type, Comparator, Allocator>& right) {
   if (left.Size() != right.Size()) return false;
 
   auto it_left = left.cbegin();
@@ -78,6 +85,16 @@ bool operator==(const s21::Map<Key, Type>& left,
   return true;
 }
 
+namespace pmr {
+
+template <typename Key, typename Value,
+          typename Comparator = Utility::Less<const Key>>
+using Map =
+    s21::Map<Key, Value, Comparator,
+             std::pmr::polymorphic_allocator<std::pair<const Key, Value>>>;
+
+}  // namespace pmr
+
 }  // namespace s21
 
 #endif  //  _S21_MAP_H_
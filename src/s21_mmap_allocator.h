@@ -0,0 +1,108 @@
+#ifndef _S21_MMAP_ALLOCATOR_H_
+#define _S21_MMAP_ALLOCATOR_H_
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+namespace s21 {
+
+// Allocator for big Vectors: chunks of at least Threshold bytes are mapped
+// from the kernel directly (huge pages are asked for where available), the
+// smaller ones come from std::allocator. A mapped chunk of trivially
+// copyable elements grows and shrinks by remapping its pages (mremap on
+// Linux): no copying and no moment with both chunks mapped
+template <typename Type, std::size_t Threshold = 2ull * 1024ull * 1024ull>
+class MmapAllocator {
+ public:
+  using value_type = Type;
+  using size_type = std::size_t;
+  using propagate_on_container_move_assignment = std::true_type;
+  using is_always_equal = std::true_type;
+
+  template <typename Other>
+  struct rebind {
+    using other = MmapAllocator<Other, Threshold>;
+  };
+
+ public:
+  MmapAllocator() noexcept = default;
+  template <typename Other>
+  MmapAllocator(const MmapAllocator<Other, Threshold>&) noexcept {}
+
+  Type* allocate(size_type count) {
+    if (!mapped(count)) return std::allocator<Type>().allocate(count);
+
+    const size_type length = pageRound(count);
+    void* chunk = mmap(nullptr, length, PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (chunk == MAP_FAILED) throw std::bad_alloc();
+    adviseHugePages(chunk, length);
+    return static_cast<Type*>(chunk);
+  }
+
+  void deallocate(Type* pointer, size_type count) noexcept {
+    if (!mapped(count)) {
+      std::allocator<Type>().deallocate(pointer, count);
+      return;
+    }
+    munmap(pointer, pageRound(count));
+  }
+
+  // Vector calls it instead of allocate, relocate and deallocate when it is
+  // there. Gives the chunk of new_count elements with the old ones kept, or
+  // nullptr when pointer is left as is and the usual way is to be taken
+  Type* reallocate(Type* pointer, size_type old_count, size_type new_count) {
+#ifdef __linux__
+    if (!mapped(old_count) || !mapped(new_count)) return nullptr;
+
+    const size_type length = pageRound(new_count);
+    void* chunk =
+        mremap(pointer, pageRound(old_count), length, MREMAP_MAYMOVE);
+    if (chunk == MAP_FAILED) throw std::bad_alloc();
+    adviseHugePages(chunk, length);
+    return static_cast<Type*>(chunk);
+#else
+    (void)pointer;
+    (void)old_count;
+    (void)new_count;
+    return nullptr;
+#endif
+  }
+
+  template <typename Other>
+  bool operator==(const MmapAllocator<Other, Threshold>&) const noexcept {
+    return true;
+  }
+  template <typename Other>
+  bool operator!=(const MmapAllocator<Other, Threshold>&) const noexcept {
+    return false;
+  }
+
+ private:
+  static bool mapped(size_type count) noexcept {
+    return count * sizeof(Type) >= Threshold;
+  }
+
+  static size_type pageRound(size_type count) noexcept {
+    static const size_type page = static_cast<size_type>(sysconf(_SC_PAGESIZE));
+    return (count * sizeof(Type) + page - 1ull) / page * page;
+  }
+
+  static void adviseHugePages(void* chunk, size_type length) noexcept {
+#ifdef MADV_HUGEPAGE
+    madvise(chunk, length, MADV_HUGEPAGE);  // only a hint, may be refused
+#else
+    (void)chunk;
+    (void)length;
+#endif
+  }
+};
+
+}  // namespace s21
+
+#endif  //  _S21_MMAP_ALLOCATOR_H_
@@ -2,6 +2,9 @@
 #define _S21_MULTIMAP_H_
 
 #include <initializer_list>
+#include <memory>
+#include <memory_resource>
+#include <utility>
 
 #include "s21_multitree.h"
 #include "s21_utility.h"
@@ -9,20 +12,39 @@
 namespace s21 {
 
 template <typename Key, typename Value,
-          typename Comparator = Utility::Less<const Key>>
-class MultiMap : public MultiTree<
-                     Key, std::pair<const Key, Value>, Comparator,
-                     Utility::KeyGetterMap<Key, std::pair<const Key, Value>>> {
+          typename Comparator = Utility::Less<const Key>,
+          typename Allocator = std::allocator<std::pair<const Key, Value>>>
+class MultiMap
+    : public MultiTree<Key, std::pair<const Key, Value>, Comparator,
+                       Utility::KeyGetterMap<Key, std::pair<const Key, Value>>,
+                       Allocator> {
   using Base =
       MultiTree<Key, std::pair<const Key, Value>, Comparator,
-                Utility::KeyGetterMap<Key, std::pair<const Key, Value>>>;
+                Utility::KeyGetterMap<Key, std::pair<const Key, Value>>,
+                Allocator>;
 
  public:
   MultiMap() : Base() {}
-  MultiMap(std::initializer_list<std::pair<const Key, Value>> list)
-      : Base(list) {}
+  explicit MultiMap(const Allocator& allocator) : Base(allocator) {}
+  MultiMap(const MultiMap& other, const Allocator& allocator)
+      : Base(other, allocator) {}
+  MultiMap(MultiMap&& other, const Allocator& allocator)
+      : Base(std::move(other), allocator) {}
+  MultiMap(std::initializer_list<std::pair<const Key, Value>> list,
+           const Allocator& allocator = Allocator())
+      : Base(list, allocator) {}
 };
 
+namespace pmr {
+
+template <typename Key, typename Value,
+          typename Comparator = Utility::Less<const Key>>
+using MultiMap =
+    s21::MultiMap<Key, Value, Comparator,
+                  std::pmr::polymorphic_allocator<std::pair<const Key, Value>>>;
+
+}  // namespace pmr
+
 }  // namespace s21
 
 #endif  //  _S21_MULTIMAP_H_
\ No newline at end of file
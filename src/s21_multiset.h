@@ -2,23 +2,69 @@
 #define _S21_MULTISET_H_
 
 #include <initializer_list>
+#include <memory>
+#include <memory_resource>
+#include <utility>
 
 #include "s21_multitree.h"
 #include "s21_utility.h"
 
 namespace s21 {
 
-template <typename Value, typename Comparator = Utility::Less<Value>>
-class MultiSet
-    : public MultiTree<Value, Value, Comparator, Utility::KeyGetterSet<Value>> {
-  using Base =
-      MultiTree<Value, Value, Comparator, Utility::KeyGetterSet<Value>>;
+template <typename Value, typename Comparator = Utility::Less<Value>,
+          typename Allocator = std::allocator<Value>>
+class MultiSet : public MultiTree<Value, Value, Comparator,
+                                  Utility::KeyGetterSet<Value>, Allocator> {
+  using Base = MultiTree<Value, Value, Comparator, Utility::KeyGetterSet<Value>,
+                         Allocator>;
 
  public:
   MultiSet() : Base() {}
-  MultiSet(std::initializer_list<Value> list) : Base(list) {}
+  explicit MultiSet(const Allocator& allocator) : Base(allocator) {}
+  MultiSet(const MultiSet& other, const Allocator& allocator)
+      : Base(other, allocator) {}
+  MultiSet(MultiSet&& other, const Allocator& allocator)
+      : Base(std::move(other), allocator) {}
+  MultiSet(std::initializer_list<Value> list,
+           const Allocator& allocator = Allocator())
+      : Base(list, allocator) {}
+};
+
+// MultiSet for the value types where equivalent means identical (integers,
+// for example): one node per distinct value keeps the value and its count
+template <typename Value, typename Comparator = Utility::Less<Value>,
+          typename Allocator = std::allocator<Value>>
+class CountedMultiSet
+    : public MultiTree<Value, Value, Comparator, Utility::KeyGetterSet<Value>,
+                       Allocator, MultiTreeCountedGroup<Value, Allocator>> {
+  using Base = MultiTree<Value, Value, Comparator, Utility::KeyGetterSet<Value>,
+                         Allocator, MultiTreeCountedGroup<Value, Allocator>>;
+
+ public:
+  CountedMultiSet() : Base() {}
+  explicit CountedMultiSet(const Allocator& allocator) : Base(allocator) {}
+  CountedMultiSet(const CountedMultiSet& other, const Allocator& allocator)
+      : Base(other, allocator) {}
+  CountedMultiSet(CountedMultiSet&& other, const Allocator& allocator)
+      : Base(std::move(other), allocator) {}
+  CountedMultiSet(std::initializer_list<Value> list,
+                  const Allocator& allocator = Allocator())
+      : Base(list, allocator) {}
 };
 
+namespace pmr {
+
+template <typename Value, typename Comparator = Utility::Less<Value>>
+using MultiSet =
+    s21::MultiSet<Value, Comparator, std::pmr::polymorphic_allocator<Value>>;
+
+template <typename Value, typename Comparator = Utility::Less<Value>>
+using CountedMultiSet =
+    s21::CountedMultiSet<Value, Comparator,
+                         std::pmr::polymorphic_allocator<Value>>;
+
+}  // namespace pmr
+
 }  // namespace s21
 
 #endif  //  _S21_MULTISET_H_
\ No newline at end of file
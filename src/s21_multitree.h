@@ -1,17 +1,509 @@
 #ifndef _S21_MULTITREE_H_
 #define _S21_MULTITREE_H_
 
+#include <algorithm>
 #include <initializer_list>
+#include <memory>
+#include <new>
+#include <optional>
+#include <type_traits>
 #include <utility>
 
-#include "s21_list.h"
 #include "s21_tree.h"
 #include "s21_utility.h"
+#include "s21_vector.h"
 
 namespace s21 {
 
-template <typename TreeIterator, typename NodeIterator, typename Pointer,
-          typename Reference, typename Difference_type, typename Size_type>
+// Storage for all the elements with equivalent keys. Up to N of them are kept
+// right inside the tree node, a bigger group spills to one contiguous chunk.
+// By default as many elements are inline as fit into two pointers, at least one
+template <typename Value, typename Allocator = std::allocator<Value>,
+          std::size_t N = sizeof(Value) < 2ull * sizeof(void*)
+                              ? 2ull * sizeof(void*) / sizeof(Value)
+                              : 1ull>
+class MultiTreeGroup : private Utility::AllocatorHolder<Allocator> {
+  static_assert(N > 0ull, "At least one element should fit inline!");
+
+  using traits = std::allocator_traits<Allocator>;
+
+ public:
+  using allocator_type = Allocator;
+  using value_type = Value;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using pointer = value_type*;
+  using const_pointer = const value_type*;
+
+  // the elements may be kept out of the tree node
+  static constexpr bool kSpills = true;
+
+ private:
+  union Storage {
+    pointer heap_;
+    alignas(value_type) char inline_[N * sizeof(value_type)];
+  };
+
+  Storage storage_;
+  size_type size_;
+  size_type capacity_;  // N while the elements are inline
+
+ public:
+  MultiTreeGroup() noexcept(noexcept(Allocator()))
+      : size_{0ull}, capacity_{N} {}
+  explicit MultiTreeGroup(const Allocator& allocator) noexcept
+      : Utility::AllocatorHolder<Allocator>(allocator),
+        size_{0ull},
+        capacity_{N} {}
+
+  MultiTreeGroup(const MultiTreeGroup& other)
+      : MultiTreeGroup(other, traits::select_on_container_copy_construction(
+                                  other.allocator())) {}
+  MultiTreeGroup(const MultiTreeGroup& other, const Allocator& allocator)
+      : MultiTreeGroup(allocator) {
+    if (other.size_ > N) grow(other.size_);
+    for (size_type i = 0ull; i < other.size_; ++i) {
+      traits::construct(this->allocator(), Data() + i, other.Data()[i]);
+      ++size_;
+    }
+  }
+  MultiTreeGroup(MultiTreeGroup&& other) noexcept(
+      std::is_nothrow_move_constructible_v<value_type>)
+      : MultiTreeGroup(other.allocator()) {
+    steal(other);
+  }
+  // the chunk of other is taken only when it can be freed with the
+  // allocator, otherwise the elements are moved one by one
+  MultiTreeGroup(MultiTreeGroup&& other, const Allocator& allocator)
+      : MultiTreeGroup(allocator) {
+    if (this->allocator() == other.allocator()) {
+      steal(other);
+      return;
+    }
+    if (other.size_ > N) grow(other.size_);
+    for (size_type i = 0ull; i < other.size_; ++i) {
+      traits::construct(this->allocator(), Data() + i,
+                        std::move(other.Data()[i]));
+      ++size_;
+    }
+    other.deallocate();
+  }
+  MultiTreeGroup& operator=(const MultiTreeGroup& other) {
+    if (this == &other) return *this;
+
+    MultiTreeGroup temporary(other);
+    *this = std::move(temporary);
+    return *this;
+  }
+  // the groups of one tree share equal allocators, so the chunk of other is
+  // always taken as is
+  MultiTreeGroup& operator=(MultiTreeGroup&& other) noexcept(
+      std::is_nothrow_move_constructible_v<value_type>) {
+    if (this == &other) return *this;
+
+    deallocate();
+    if constexpr (traits::propagate_on_container_move_assignment::value)
+      this->allocator() = std::move(other.allocator());
+    assert(this->allocator() == other.allocator() &&
+           "Moving groups with unequal allocators!");
+    steal(other);
+    return *this;
+  }
+  ~MultiTreeGroup() { deallocate(); }
+
+  allocator_type Get_allocator() const noexcept { return this->allocator(); }
+
+  size_type Size() const noexcept { return size_; }
+  bool Empty() const noexcept { return size_ == 0ull; }
+
+  pointer Data() noexcept {
+    return spilled() ? storage_.heap_
+                     : reinterpret_cast<pointer>(storage_.inline_);
+  }
+  const_pointer Data() const noexcept {
+    return spilled() ? storage_.heap_
+                     : reinterpret_cast<const_pointer>(storage_.inline_);
+  }
+
+  reference operator[](size_type pos) { return Data()[pos]; }
+  const_reference operator[](size_type pos) const { return Data()[pos]; }
+
+  reference Front() { return Data()[0ull]; }
+  const_reference Front() const { return Data()[0ull]; }
+
+  void Push_back(const_reference value) { Emplace_back(value); }
+  void Push_back(value_type&& value) { Emplace_back(std::move(value)); }
+
+  template <class... Args>
+  reference Emplace_back(Args&&... args) {
+    if (size_ == capacity_) {
+      // the new element is constructed before relocation: args may refer to
+      // the elements of this very group
+      pointer new_data = allocate(capacity_ * 2ull);
+      try {
+        traits::construct(this->allocator(), new_data + size_,
+                          std::forward<Args>(args)...);
+      } catch (...) {
+        traits::deallocate(this->allocator(), new_data, capacity_ * 2ull);
+        throw;
+      }
+      relocate(new_data);
+      storage_.heap_ = new_data;
+      capacity_ *= 2ull;
+    } else {
+      traits::construct(this->allocator(), Data() + size_,
+                        std::forward<Args>(args)...);
+    }
+    ++size_;
+    return Data()[size_ - 1ull];
+  }
+
+  // the element goes before the one at index, the ones after it are
+  // relocated like in Erase
+  void Insert(size_type index, value_type&& value) {
+    assert(index <= size_ && "Inserting out of the group!");
+
+    if constexpr (!std::is_nothrow_move_constructible_v<value_type>) {
+      if (index < size_) {
+        insertCopying(index, std::move(value));
+        return;
+      }
+    }
+    Emplace_back(std::move(value));
+    if (index + 1ull == size_) return;
+
+    pointer data = Data();
+    value_type last(std::move(data[size_ - 1ull]));
+    for (size_type i = size_ - 1ull; i > index; --i) {
+      traits::destroy(this->allocator(), data + i);
+      traits::construct(this->allocator(), data + i,
+                        std::move(data[i - 1ull]));
+    }
+    traits::destroy(this->allocator(), data + index);
+    traits::construct(this->allocator(), data + index, std::move(last));
+  }
+
+  void Erase(size_type index) {
+    assert(index < size_ && "Erasing non-existing element!");
+
+    if constexpr (!std::is_nothrow_move_constructible_v<value_type>) {
+      if (index + 1ull < size_) {
+        eraseCopying(index);
+        return;
+      }
+    }
+    pointer data = Data();
+    // relocation instead of assignment: pair<const Key, Value> is not
+    // assignable
+    for (size_type i = index; i + 1ull < size_; ++i) {
+      traits::destroy(this->allocator(), data + i);
+      traits::construct(this->allocator(), data + i,
+                        std::move(data[i + 1ull]));
+    }
+    traits::destroy(this->allocator(), data + size_ - 1ull);
+    --size_;
+  }
+
+  value_type Extract(size_type index) {
+    value_type result(std::move(Data()[index]));
+    Erase(index);
+    return result;
+  }
+
+ private:
+  bool spilled() const noexcept { return capacity_ > N; }
+
+  // no constructors are called
+  pointer allocate(size_type count) {
+    return traits::allocate(this->allocator(), count);
+  }
+
+  // a move which throws after its slot is destroyed would leave a hole among
+  // the elements, so the rest of them are copied (moved when they can not
+  // be copied) into a new chunk; when that throws the group stays as it is
+  void eraseCopying(size_type index) {
+    const size_type new_capacity = spilled() ? capacity_ : N + 1ull;
+    pointer new_data = allocate(new_capacity);
+    pointer data = Data();
+    size_type made = 0ull;
+    try {
+      for (size_type i = 0ull; i < size_; ++i) {
+        if (i == index) continue;
+        traits::construct(this->allocator(), new_data + made,
+                          std::move_if_noexcept(data[i]));
+        ++made;
+      }
+    } catch (...) {
+      while (made) traits::destroy(this->allocator(), new_data + --made);
+      traits::deallocate(this->allocator(), new_data, new_capacity);
+      throw;
+    }
+    deallocate();
+    storage_.heap_ = new_data;
+    capacity_ = new_capacity;
+    size_ = made;
+  }
+
+  // the same for inserting: the elements around the new one are copied into
+  // a new chunk, when that throws the group stays as it is
+  void insertCopying(size_type index, value_type&& value) {
+    const size_type new_capacity =
+        spilled() && size_ < capacity_ ? capacity_ : capacity_ * 2ull;
+    pointer new_data = allocate(new_capacity);
+    pointer data = Data();
+    size_type made = 0ull;
+    try {
+      for (; made <= size_; ++made) {
+        if (made < index)
+          traits::construct(this->allocator(), new_data + made,
+                            std::move_if_noexcept(data[made]));
+        else if (made == index)
+          traits::construct(this->allocator(), new_data + made,
+                            std::move(value));
+        else
+          traits::construct(this->allocator(), new_data + made,
+                            std::move_if_noexcept(data[made - 1ull]));
+      }
+    } catch (...) {
+      while (made) traits::destroy(this->allocator(), new_data + --made);
+      traits::deallocate(this->allocator(), new_data, new_capacity);
+      throw;
+    }
+    deallocate();
+    storage_.heap_ = new_data;
+    capacity_ = new_capacity;
+    size_ = made;
+  }
+
+  void grow(size_type exact_count) {
+    pointer new_data = allocate(exact_count);
+    relocate(new_data);
+    storage_.heap_ = new_data;
+    capacity_ = exact_count;
+  }
+
+  // moves the elements to new_data releasing the old chunk, if any
+  void relocate(pointer new_data) {
+    pointer data = Data();
+    for (size_type i = 0ull; i < size_; ++i) {
+      traits::construct(this->allocator(), new_data + i, std::move(data[i]));
+      traits::destroy(this->allocator(), data + i);
+    }
+    if (spilled()) traits::deallocate(this->allocator(), data, capacity_);
+  }
+
+  void steal(MultiTreeGroup& other) noexcept(
+      std::is_nothrow_move_constructible_v<value_type>) {
+    if (other.spilled()) {
+      storage_.heap_ = other.storage_.heap_;
+      capacity_ = other.capacity_;
+    } else {
+      pointer data = Data();
+      pointer other_data = other.Data();
+      for (size_type i = 0ull; i < other.size_; ++i) {
+        traits::construct(this->allocator(), data + i,
+                          std::move(other_data[i]));
+        traits::destroy(this->allocator(), other_data + i);
+      }
+    }
+    size_ = other.size_;
+
+    other.size_ = 0ull;
+    other.capacity_ = N;
+  }
+
+  void deallocate() noexcept {
+    pointer data = Data();
+    for (size_type i = 0ull; i < size_; ++i)
+      traits::destroy(this->allocator(), data + i);
+    if (spilled()) traits::deallocate(this->allocator(), data, capacity_);
+    size_ = 0ull;
+    capacity_ = N;
+  }
+};
+
+// Group for the value types where equivalent means identical: keeps one copy
+// of the value and the number of its repetitions
+template <typename Value, typename Allocator = std::allocator<Value>>
+class MultiTreeCountedGroup : private Utility::AllocatorHolder<Allocator> {
+  using traits = std::allocator_traits<Allocator>;
+
+ public:
+  using allocator_type = Allocator;
+  using value_type = Value;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using pointer = value_type*;
+  using const_pointer = const value_type*;
+
+  static constexpr bool kSpills = false;
+
+ private:
+  alignas(value_type) char storage_[sizeof(value_type)];  // constructed when
+                                                          // count_ is not 0
+  size_type count_;
+
+ public:
+  MultiTreeCountedGroup() noexcept(noexcept(Allocator())) : count_{0ull} {}
+  explicit MultiTreeCountedGroup(const Allocator& allocator) noexcept
+      : Utility::AllocatorHolder<Allocator>(allocator), count_{0ull} {}
+
+  MultiTreeCountedGroup(const MultiTreeCountedGroup& other)
+      : MultiTreeCountedGroup(
+            other, traits::select_on_container_copy_construction(
+                       other.allocator())) {}
+  MultiTreeCountedGroup(const MultiTreeCountedGroup& other,
+                        const Allocator& allocator)
+      : MultiTreeCountedGroup(allocator) {
+    if (other.count_)
+      traits::construct(this->allocator(), data(), other.Front());
+    count_ = other.count_;
+  }
+  MultiTreeCountedGroup(MultiTreeCountedGroup&& other) noexcept(
+      std::is_nothrow_move_constructible_v<value_type>)
+      : MultiTreeCountedGroup(other.allocator()) {
+    steal(other);
+  }
+  MultiTreeCountedGroup(MultiTreeCountedGroup&& other,
+                        const Allocator& allocator)
+      : MultiTreeCountedGroup(allocator) {
+    steal(other);
+  }
+  MultiTreeCountedGroup& operator=(const MultiTreeCountedGroup& other) {
+    if (this == &other) return *this;
+
+    MultiTreeCountedGroup temporary(other);
+    *this = std::move(temporary);
+    return *this;
+  }
+  MultiTreeCountedGroup& operator=(MultiTreeCountedGroup&& other) noexcept(
+      std::is_nothrow_move_constructible_v<value_type>) {
+    if (this == &other) return *this;
+
+    deallocate();
+    if constexpr (traits::propagate_on_container_move_assignment::value)
+      this->allocator() = std::move(other.allocator());
+    steal(other);
+    return *this;
+  }
+  ~MultiTreeCountedGroup() { deallocate(); }
+
+  allocator_type Get_allocator() const noexcept { return this->allocator(); }
+
+  size_type Size() const noexcept { return count_; }
+  bool Empty() const noexcept { return count_ == 0ull; }
+
+  // every position holds the same value
+  reference operator[](size_type) { return Front(); }
+  const_reference operator[](size_type) const { return Front(); }
+
+  reference Front() { return *data(); }
+  const_reference Front() const { return *data(); }
+
+  void Push_back(const_reference value) { Emplace_back(value); }
+  void Push_back(value_type&& value) { Emplace_back(std::move(value)); }
+
+  // the value is constructed only for the first element of the group
+  template <class... Args>
+  reference Emplace_back(Args&&... args) {
+    if (!count_)
+      traits::construct(this->allocator(), data(), std::forward<Args>(args)...);
+    ++count_;
+    return Front();
+  }
+
+  // all the elements are the same, so any place will do
+  void Insert(size_type, value_type&& value) {
+    Emplace_back(std::move(value));
+  }
+
+  void Erase(size_type) {
+    assert(count_ && "Erasing non-existing element!");
+
+    --count_;
+    if (!count_) traits::destroy(this->allocator(), data());
+  }
+
+  value_type Extract(size_type index) {
+    if (count_ > 1ull) {
+      value_type result(Front());
+      Erase(index);
+      return result;
+    }
+    value_type result(std::move(Front()));
+    Erase(index);
+    return result;
+  }
+
+ private:
+  pointer data() noexcept { return reinterpret_cast<pointer>(storage_); }
+  const_pointer data() const noexcept {
+    return reinterpret_cast<const_pointer>(storage_);
+  }
+
+  void steal(MultiTreeCountedGroup& other) noexcept(
+      std::is_nothrow_move_constructible_v<value_type>) {
+    if (other.count_) {
+      traits::construct(this->allocator(), data(), std::move(other.Front()));
+      traits::destroy(other.allocator(), other.data());
+    }
+    count_ = other.count_;
+    other.count_ = 0ull;
+  }
+
+  void deallocate() noexcept {
+    if (count_) traits::destroy(this->allocator(), data());
+    count_ = 0ull;
+  }
+};
+
+// Group with a copy of the key of its elements. Kept in the tree node next
+// to the group, the key is compared without following the pointer of a
+// spilled group. The sentinel groups have no key, so KeyType need not be
+// default constructible
+template <typename KeyType, typename Group>
+class MultiTreeKeyedGroup : public Group {
+ public:
+  using allocator_type = typename Group::allocator_type;
+
+ private:
+  std::optional<KeyType> key_;  // empty only in the sentinels
+
+ public:
+  // for the sentinel nodes of the tree, like every value of a Tree
+  MultiTreeKeyedGroup() : Group() {}
+  MultiTreeKeyedGroup(const KeyType& key, const allocator_type& allocator)
+      : Group(allocator), key_{key} {}
+
+  MultiTreeKeyedGroup(const MultiTreeKeyedGroup& other) = default;
+  MultiTreeKeyedGroup(const MultiTreeKeyedGroup& other,
+                      const allocator_type& allocator)
+      : Group(other, allocator), key_{other.key_} {}
+  MultiTreeKeyedGroup(MultiTreeKeyedGroup&& other) = default;
+  MultiTreeKeyedGroup(MultiTreeKeyedGroup&& other,
+                      const allocator_type& allocator)
+      : Group(std::move(other), allocator), key_{std::move(other.key_)} {}
+  MultiTreeKeyedGroup& operator=(const MultiTreeKeyedGroup& other) = default;
+  MultiTreeKeyedGroup& operator=(MultiTreeKeyedGroup&& other) = default;
+
+  const KeyType& Key() const noexcept {
+    assert(key_ && "The sentinel group has no key!");
+    return *key_;
+  }
+};
+
+template <typename Key, typename Value, typename Comparator, typename KeyGetter,
+          typename Allocator, typename Group>
+class MultiTree;
+
+// Position is the tree node holding the group and the index inside of it.
+// Sentinel nodes of the tree hold empty groups, so end() is (end node, 0)
+template <typename TreeIterator, typename Pointer, typename Reference,
+          typename Difference_type, typename Size_type>
 class MultiTreeIteratorBase {
  public:
   using difference_type = Difference_type;
@@ -20,82 +512,56 @@ class MultiTreeIteratorBase {
   using size_type = Size_type;
   using iterator_category = std::bidirectional_iterator_tag;
 
+  template <typename Key, typename Value, typename Comparator,
+            typename KeyGetter, typename Allocator, typename Group>
+  friend class MultiTree;  // to erase and extract by position in the group
+
  protected:
   TreeIterator treeIterator_;
-  TreeIterator treeBeforeBegin_;
-  TreeIterator treeEnd_;
-  NodeIterator nodeIterator_;
+  size_type index_;
 
  public:
-  MultiTreeIteratorBase(TreeIterator treeIterator, TreeIterator treeBeforeBegin,
-                        TreeIterator treeEnd, NodeIterator nodeIterator)
-      : treeIterator_{treeIterator},
-        treeBeforeBegin_{treeBeforeBegin},
-        treeEnd_{treeEnd},
-        nodeIterator_{nodeIterator} {}
-  MultiTreeIteratorBase(const MultiTreeIteratorBase& other)
-      : treeIterator_{other.treeIterator_},
-        treeBeforeBegin_{other.treeBeforeBegin_},
-        treeEnd_{other.treeEnd_},
-        nodeIterator_{other.nodeIterator_} {}
-
-  MultiTreeIteratorBase& operator=(const MultiTreeIteratorBase& other) {
-    treeIterator_ = other.treeIterator_;
-    treeBeforeBegin_ = other.treeBeforeBegin_;
-    treeEnd_ = other.treeEnd_;
-    nodeIterator_ = other.nodeIterator_;
-  }
+  MultiTreeIteratorBase(TreeIterator treeIterator, size_type index) noexcept
+      : treeIterator_{treeIterator}, index_{index} {}
 
   bool operator==(const MultiTreeIteratorBase& other) const noexcept {
-    if (treeIterator_ == treeEnd_ && other.treeIterator_ == treeIterator_)
-      return true;
-    if (treeIterator_ == treeBeforeBegin_ &&
-        other.treeIterator_ == treeIterator_)
-      return true;
-
-    return other.treeIterator_ == treeIterator_ &&
-           other.nodeIterator_ == nodeIterator_ &&
-           other.treeBeforeBegin_ == treeBeforeBegin_ &&
-           other.treeEnd_ == treeEnd_;
+    return treeIterator_ == other.treeIterator_ && index_ == other.index_;
   }
 
   bool operator!=(const MultiTreeIteratorBase& other) const noexcept {
     return !(other == *this);
   }
 
-  Pointer operator->() { return nodeIterator_.operator->(); }
-  Pointer operator->() const { return nodeIterator_.operator->(); }
-  Reference operator*() { return nodeIterator_.operator*(); }
-  Reference operator*() const { return nodeIterator_.operator*(); }
+  Pointer operator->() const { return &(*treeIterator_)[index_]; }
+  Reference operator*() const { return (*treeIterator_)[index_]; }
 
   MultiTreeIteratorBase& operator++() {
-    if (treeIterator_ == treeBeforeBegin_ ||
-        nodeIterator_ == --(treeIterator_->end())) {
-      ++treeIterator_;
-      if (treeIterator_ != treeEnd_) nodeIterator_ = treeIterator_->begin();
+    if (index_ + 1ull < (*treeIterator_).Size()) {
+      ++index_;
       return *this;
     }
-    ++nodeIterator_;
+    ++treeIterator_;
+    index_ = 0ull;
     return *this;
   }
   MultiTreeIteratorBase& operator--() {
-    if (treeIterator_ == treeEnd_ || nodeIterator_ == treeIterator_->begin()) {
-      --treeIterator_;
-      if (treeIterator_ != treeBeforeBegin_)
-        nodeIterator_ = --(treeIterator_->end());
+    if (index_) {
+      --index_;
       return *this;
     }
-    --nodeIterator_;
+    --treeIterator_;
+    const size_type size = (*treeIterator_).Size();
+    index_ = size ? size - 1ull : 0ull;
     return *this;
   }
 };
-template <typename TreeIterator, typename NodeIterator, typename Pointer,
-          typename Reference, typename Difference_type, typename Size_type>
+template <typename TreeIterator, typename Pointer, typename Reference,
+          typename Difference_type, typename Size_type>
 class MultiTreeIterator
-    : public MultiTreeIteratorBase<TreeIterator, NodeIterator, Pointer,
-                                   Reference, Difference_type, Size_type> {
-  using Base = MultiTreeIteratorBase<TreeIterator, NodeIterator, Pointer,
-                                     Reference, Difference_type, Size_type>;
+    : public MultiTreeIteratorBase<TreeIterator, Pointer, Reference,
+                                   Difference_type, Size_type> {
+  using Base = MultiTreeIteratorBase<TreeIterator, Pointer, Reference,
+                                     Difference_type, Size_type>;
 
  public:
   using Base::Base;
@@ -120,26 +586,23 @@ class MultiTreeIterator
     return temporary;
   }
 
-  template <typename OtherTreeIterator, typename OtherNodeIterator,
-            typename OtherPointer, typename OtherReference>
-  explicit
-  operator MultiTreeIterator<OtherTreeIterator, OtherNodeIterator, OtherPointer,
-                             OtherReference, Difference_type, Size_type>() {
-    return MultiTreeIterator<OtherTreeIterator, OtherNodeIterator, OtherPointer,
-                             OtherReference, Difference_type, Size_type>(
-        static_cast<OtherTreeIterator>(this->treeIterator_),
-        static_cast<OtherTreeIterator>(this->treeBeforeBegin_),
-        static_cast<OtherTreeIterator>(this->treeEnd_),
-        static_cast<OtherNodeIterator>(this->nodeIterator_));
+  template <typename OtherTreeIterator, typename OtherPointer,
+            typename OtherReference>
+  explicit operator MultiTreeIterator<OtherTreeIterator, OtherPointer,
+                                      OtherReference, Difference_type,
+                                      Size_type>() const {
+    return MultiTreeIterator<OtherTreeIterator, OtherPointer, OtherReference,
+                             Difference_type, Size_type>(
+        static_cast<OtherTreeIterator>(this->treeIterator_), this->index_);
   }
 };
-template <typename TreeIterator, typename NodeIterator, typename Pointer,
-          typename Reference, typename Difference_type, typename Size_type>
+template <typename TreeIterator, typename Pointer, typename Reference,
+          typename Difference_type, typename Size_type>
 class MultiTreeReverseIterator
-    : public MultiTreeIteratorBase<TreeIterator, NodeIterator, Pointer,
-                                   Reference, Difference_type, Size_type> {
-  using Base = MultiTreeIteratorBase<TreeIterator, NodeIterator, Pointer,
-                                     Reference, Difference_type, Size_type>;
+    : public MultiTreeIteratorBase<TreeIterator, Pointer, Reference,
+                                   Difference_type, Size_type> {
+  using Base = MultiTreeIteratorBase<TreeIterator, Pointer, Reference,
+                                     Difference_type, Size_type>;
 
  public:
   using Base::Base;
@@ -164,24 +627,24 @@ class MultiTreeReverseIterator
     return temporary;
   }
 
-  template <typename OtherTreeIterator, typename OtherNodeIterator,
-            typename OtherPointer, typename OtherReference>
-  explicit operator MultiTreeReverseIterator<
-      OtherTreeIterator, OtherNodeIterator, OtherPointer, OtherReference,
-      Difference_type, Size_type>() {
-    return MultiTreeReverseIterator<OtherTreeIterator, OtherNodeIterator,
-                                    OtherPointer, OtherReference,
-                                    Difference_type, Size_type>(
-        static_cast<OtherTreeIterator>(this->treeIterator_),
-        static_cast<OtherTreeIterator>(this->treeBeforeBegin_),
-        static_cast<OtherTreeIterator>(this->treeEnd_),
-        static_cast<OtherNodeIterator>(this->nodeIterator_));
+  template <typename OtherTreeIterator, typename OtherPointer,
+            typename OtherReference>
+  explicit operator MultiTreeReverseIterator<OtherTreeIterator, OtherPointer,
+                                             OtherReference, Difference_type,
+                                             Size_type>() const {
+    return MultiTreeReverseIterator<OtherTreeIterator, OtherPointer,
+                                    OtherReference, Difference_type,
+                                    Size_type>(
+        static_cast<OtherTreeIterator>(this->treeIterator_), this->index_);
   }
 };
 
-template <typename Key, typename Value, typename Comparator, typename KeyGetter>
+template <typename Key, typename Value, typename Comparator, typename KeyGetter,
+          typename Allocator = std::allocator<Value>,
+          typename Group = MultiTreeGroup<Value, Allocator>>
 class MultiTree {
  public:
+  using allocator_type = Allocator;
   using value_type = Value;
   using mapped_type = value_type;
   using key_type = Key;
@@ -193,7 +656,21 @@ class MultiTree {
   using const_pointer = const value_type*;
 
  private:
-  using aggregator_type = List<value_type>;
+  // groups which spill keep a copy of their key; a counted group has its
+  // value inline anyway
+  static constexpr bool kKeyed = Group::kSpills;
+  using aggregator_type =
+      std::conditional_t<kKeyed,
+                         MultiTreeKeyedGroup<std::remove_const_t<Key>, Group>,
+                         Group>;
+
+  static const key_type& keyOf(const aggregator_type& group,
+                               const KeyGetter& key_getter) {
+    if constexpr (kKeyed)
+      return group.Key();
+    else
+      return key_getter(group.Front());
+  }
 
  private:
   class ComparatorTree {
@@ -203,42 +680,49 @@ class MultiTree {
 
    public:
     bool operator()(const Key& left, const aggregator_type& right) const {
-      return comparator_(left, keyGetter_(*(right.begin())));
+      return comparator_(left, keyOf(right, keyGetter_));
     }
     bool operator()(const aggregator_type& left, const Key& right) const {
-      return comparator_(keyGetter_(*(left.begin())), right);
+      return comparator_(keyOf(left, keyGetter_), right);
     }
     bool operator()(const aggregator_type& left,
                     const aggregator_type& right) const {
-      return comparator_(keyGetter_(*(left.begin())),
-                         keyGetter_(*(right.begin())));
+      return comparator_(keyOf(left, keyGetter_), keyOf(right, keyGetter_));
     }
   };
 
  private:
-  using tree_type = Tree::Tree<const Key, aggregator_type, ComparatorTree>;
+  using tree_type =
+      Tree::Tree<const Key, aggregator_type, ComparatorTree,
+                 typename std::allocator_traits<
+                     Allocator>::template rebind_alloc<aggregator_type>>;
+
+  struct Node {
+    value_type value_;
+
+    explicit Node(value_type&& value) : value_{std::move(value)} {}
+  };
+  using node_allocator_type =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+  using node_deleter = Utility::AllocatorDelete<node_allocator_type>;
 
  public:
   using node_type =
-      typename aggregator_type::node_type;  // handler which forbids copying and
-                                            // is responsible for destruction
+      Utility::Handler<Node*, reference,
+                       node_deleter>;  // handler which forbids copying and
+                                       // is responsible for destruction
 
  public:
-  using iterator =
-      MultiTreeIterator<typename tree_type::iterator,
-                        typename aggregator_type::iterator, pointer, reference,
-                        difference_type, size_type>;
+  using iterator = MultiTreeIterator<typename tree_type::iterator, pointer,
+                                     reference, difference_type, size_type>;
   using const_iterator =
-      MultiTreeIterator<typename tree_type::const_iterator,
-                        typename aggregator_type::const_iterator, const_pointer,
+      MultiTreeIterator<typename tree_type::const_iterator, const_pointer,
                         const_reference, difference_type, size_type>;
   using reverse_iterator =
-      MultiTreeReverseIterator<typename tree_type::iterator,
-                               typename aggregator_type::iterator, pointer,
-                               reference, difference_type, size_type>;
+      MultiTreeReverseIterator<typename tree_type::iterator, pointer, reference,
+                               difference_type, size_type>;
   using const_reverse_iterator =
       MultiTreeReverseIterator<typename tree_type::const_iterator,
-                               typename aggregator_type::const_iterator,
                                const_pointer, const_reference, difference_type,
                                size_type>;
 
@@ -247,16 +731,45 @@ class MultiTree {
   size_type size_;
 
  private:
+  Comparator comparator_;
   KeyGetter keyGetter_;
 
  public:
   MultiTree() : size_{0ull} {}
-  MultiTree(std::initializer_list<value_type> list) : MultiTree() {
+  explicit MultiTree(const Allocator& allocator)
+      : tree_{typename tree_type::allocator_type(allocator)}, size_{0ull} {}
+  MultiTree(std::initializer_list<value_type> list,
+            const Allocator& allocator = Allocator())
+      : MultiTree(allocator) {
     for (const auto& element : list) Insert(element);
   }
 
   MultiTree(const MultiTree& other) : tree_{other.tree_}, size_{other.size_} {}
-  MultiTree(MultiTree&& other) : MultiTree() { *this = std::move(other); }
+  // the groups are copied into allocator too: they keep their elements with it
+  MultiTree(const MultiTree& other, const Allocator& allocator)
+      : MultiTree(allocator) {
+    for (const aggregator_type& group : other.tree_)
+      tree_.Insert_back(aggregator_type(group, allocator));
+    size_ = other.size_;
+  }
+  // the allocator goes together with the nodes
+  MultiTree(MultiTree&& other) noexcept
+      : tree_{std::move(other.tree_)}, size_{other.size_} {
+    other.size_ = 0ull;
+  }
+  // the nodes of other are taken only when they can be freed with the
+  // allocator, otherwise the groups are moved one by one
+  MultiTree(MultiTree&& other, const Allocator& allocator)
+      : MultiTree(allocator) {
+    if (Get_allocator() == other.Get_allocator()) {
+      Swap(other);
+      return;
+    }
+    for (aggregator_type& group : other.tree_)
+      tree_.Insert_back(aggregator_type(std::move(group), allocator));
+    size_ = other.size_;
+    other.Clear();
+  }
   MultiTree& operator=(const MultiTree& other) {
     if (this == &other) return *this;
     MultiTree temporary(other);
@@ -272,41 +785,103 @@ class MultiTree {
     return *this;
   }
 
-  std::pair<iterator, bool> Insert(const_reference value) {
-    typename tree_type::iterator it = tree_.Find(keyGetter_(value));
-    ++size_;
+  allocator_type Get_allocator() const noexcept {
+    return allocator_type(tree_.Get_allocator());
+  }
 
-    if (it == tree_.end()) {
-      aggregator_type list;
-      list.Push_back(std::move(value));
-      auto [added_it, _] = tree_.Insert(list);
-      return {
-          iterator(added_it, --(tree_.begin()), tree_.end(), added_it->begin()),
-          true};
-    }
+  std::pair<iterator, bool> Insert(const_reference value) {
+    return {insert(value), true};
+  }
+  std::pair<iterator, bool> Insert(value_type&& value) {
+    return {insert(std::move(value)), true};
+  }
 
-    it->Push_back(value);
-    return {iterator(it, --(tree_.begin()), tree_.end(), --(it->end())), true};
+  // the key is known only after construction: the value is built once and
+  // then moved into its group
+  template <class... Args>
+  iterator Emplace(Args&&... args) {
+    value_type value(std::forward<Args>(args)...);
+    return insert(std::move(value));
   }
 
-  template <typename Last>
-  void insert_many(Vector<std::pair<iterator, bool>>& vector, Last last) {
-    vector.Push_back(Insert(std::forward<Last>(last)));
+  // the lookup is skipped when hint points into the group of the equivalent
+  // key, then the element goes right before hint, or right after that group
+  // (end() when appending in ascending order)
+  template <class... Args>
+  iterator Emplace_hint(const_iterator hint, Args&&... args) {
+    value_type value(std::forward<Args>(args)...);
+    typename tree_type::iterator it =
+        static_cast<typename tree_type::iterator>(hint.treeIterator_);
+    if (!tree_.Empty()) {
+      if (it != tree_.end() && equivalent(keyGetter_(value), *it)) {
+        it->Insert(hint.index_, std::move(value));
+        ++size_;
+        return iterator(it, hint.index_);
+      }
+      if (it != tree_.begin() && equivalent(keyGetter_(value), *(--it)))
+        return append(it, std::move(value));
+    }
+    return insert(std::move(value));
   }
 
-  template <typename First, class... Args>
-  void insert_many(Vector<std::pair<iterator, bool>>& vector, First first,
-                   Args&&... args) {
-    vector.Push_back(Insert(std::forward<First>(first)));
-    insert_many(vector, std::forward<Args>(args)...);
+  template <class... Args>
+  iterator Emplace_hint(iterator hint, Args&&... args) {
+    return Emplace_hint(static_cast<const_iterator>(hint),
+                        std::forward<Args>(args)...);
   }
 
+  // values are sorted by key first, so every group is looked up once and a
+  // new group gets into the tree with all of its elements at once;
+  // results are in the order of arguments
   template <class... Args>
   Vector<std::pair<iterator, bool>> Insert_many(Args&&... args) {
-    Vector<std::pair<iterator, bool>> result;
-    result.Reserve(sizeof...(Args));
-    insert_many(result, std::forward<Args>(args)...);
+    constexpr size_type count = sizeof...(Args);
+    value_type values[] = {value_type(std::forward<Args>(args))...};
+
+    size_type order[count];
+    for (size_type i = 0ull; i < count; ++i) order[i] = i;
+    std::stable_sort(order, order + count,
+                     [this, &values](size_type left, size_type right) {
+                       return comparator_(keyGetter_(values[left]),
+                                          keyGetter_(values[right]));
+                     });
+
+    Vector<iterator> sorted;
+    sorted.Reserve(count);
+    for (size_type first = 0ull, last = 0ull; first < count; first = last) {
+      const key_type& key = keyGetter_(values[order[first]]);
+      last = first + 1ull;
+      while (last < count && !comparator_(key, keyGetter_(values[order[last]])))
+        ++last;
+
+      typename tree_type::iterator it = tree_.Find(key);
+      size_type index = 0ull;
+      if (it == tree_.end()) {
+        aggregator_type group = newGroup(key);
+        for (size_type i = first; i < last; ++i)
+          group.Push_back(std::move(values[order[i]]));
+        it = tree_.Insert(std::move(group)).first;
+        size_ += last - first;
+      } else {
+        // counted one by one: when a Push_back throws, the elements before
+        // it stay in the group
+        index = it->Size();
+        for (size_type i = first; i < last; ++i) {
+          it->Push_back(std::move(values[order[i]]));
+          ++size_;
+        }
+      }
+      for (size_type i = first; i < last; ++i)
+        sorted.Push_back(iterator(it, index++));
+    }
+
+    size_type rank[count];
+    for (size_type i = 0ull; i < count; ++i) rank[order[i]] = i;
 
+    Vector<std::pair<iterator, bool>> result;
+    result.Reserve(count);
+    for (size_type i = 0ull; i < count; ++i)
+      result.Push_back({sorted[rank[i]], true});
     return result;
   }
 
@@ -314,30 +889,54 @@ class MultiTree {
     return Vector<std::pair<iterator, bool>>();
   }
 
+  // the group is reached through the position itself, only removing the last
+  // element of a group touches the tree
   iterator Erase(const_iterator pos) {
-    typename tree_type::iterator it = tree_.Find(keyGetter_(*pos));
+    typename tree_type::iterator it =
+        static_cast<typename tree_type::iterator>(pos.treeIterator_);
     assert(it != tree_.end() && "Tried to erase not existing element!");
-    --size_;
     if (it->Size() > 1ull) {
-      typename aggregator_type::iterator next_it = it->Erase(it->begin());
-      return iterator(it, --(tree_.begin()), tree_.end(), next_it);
+      it->Erase(pos.index_);
+      --size_;
+      if (pos.index_ < it->Size()) return iterator(it, pos.index_);
+      return iterator(++it, 0ull);
     }
-    typename tree_type::iterator next_it = tree_.Erase(it);
-    return iterator(next_it, --(tree_.begin()), tree_.end(), next_it->begin());
+    --size_;
+    return iterator(tree_.Erase(it), 0ull);
+  }
+
+  iterator Erase(iterator pos) {
+    return Erase(static_cast<const_iterator>(pos));
+  }
+
+  // erases all the elements with the key, returns the number of them
+  size_type Erase(const key_type& key) {
+    typename tree_type::iterator it = tree_.Find(key);
+    if (it == tree_.end()) return 0ull;
+
+    const size_type count = it->Size();
+    size_ -= count;
+    tree_.Erase(it);
+    return count;
   }
 
   node_type Extract(const_iterator pos) {
-    typename tree_type::iterator it = tree_.Find(keyGetter_(*pos));
-    --size_;
-    if (it->Size() > 1ull) {
-      for (auto nodeIt = it->begin(); nodeIt != it->end(); ++nodeIt) {
-        if (*nodeIt == *pos) return it->Extract(nodeIt);
-      }
+    typename tree_type::iterator it =
+        static_cast<typename tree_type::iterator>(pos.treeIterator_);
+    assert(it != tree_.end() && "Tried to extract not existing element!");
+    node_allocator_type allocator(Get_allocator());
+    if (it->Size() == 1ull) {
+      // the group leaves the tree first: finding its node takes its key
+      auto group = tree_.Extract(it);
+      node_type node(Utility::Create(allocator, group.Get().Extract(0ull)),
+                     node_deleter(allocator));
+      --size_;
+      return node;
     }
-
-    typename tree_type::node_handler treeNode = tree_.Extract(it);
-    node_type listNode(treeNode->value_.Extract(treeNode->value_.begin()));
-    return listNode;
+    node_type node(Utility::Create(allocator, it->Extract(pos.index_)),
+                   node_deleter(allocator));
+    --size_;
+    return node;
   }
 
   node_type Extract(iterator pos) {
@@ -345,6 +944,19 @@ class MultiTree {
     return Extract(it);
   }
 
+  // erases all the elements with keys less than the key (retention trimming),
+  // returns the number of them
+  size_type Erase_before(const key_type& key) {
+    size_type count = 0ull;
+    while (!tree_.Empty() &&
+           comparator_(keyOf(*tree_.begin(), keyGetter_), key)) {
+      count += tree_.begin()->Size();
+      tree_.Erase(tree_.begin());
+    }
+    size_ -= count;
+    return count;
+  }
+
   size_type Size() const noexcept { return size_; }
   size_type Height() const noexcept { return tree_.Height(); }
 
@@ -355,51 +967,52 @@ class MultiTree {
 
   iterator Find(const key_type& key) {
     typename tree_type::iterator it = tree_.Find(key);
-    return iterator(it, --(tree_.begin()), tree_.end(), it->begin());
+    return iterator(it, 0ull);
   }
   const_iterator Find(const key_type& key) const {
     typename tree_type::const_iterator it = tree_.Find(key);
-    return const_iterator(it, --(tree_.begin()), tree_.end(), it->begin());
+    return const_iterator(it, 0ull);
   }
 
   bool Contains(const key_type& key) const { return tree_.Contains(key); }
 
+  size_type Count(const key_type& key) const {
+    typename tree_type::const_iterator it = tree_.Find(key);
+    return it == tree_.end() ? 0ull : (*it).Size();
+  }
+
   iterator Lower_bound(const key_type& key) {
     typename tree_type::iterator it = tree_.Lower_bound(key);
-    return iterator(it, --(tree_.begin()), tree_.end(), it->begin());
+    return iterator(it, 0ull);
   }
 
   const_iterator Lower_bound(const key_type& key) const {
     typename tree_type::const_iterator it = tree_.Lower_bound(key);
-    return const_iterator(it, --(tree_.begin()), tree_.end(), it->begin());
+    return const_iterator(it, 0ull);
   }
 
   iterator Upper_bound(const key_type& key) {
     typename tree_type::iterator it = tree_.Upper_bound(key);
-    return iterator(it, --(tree_.begin()), tree_.end(), it->begin());
+    return iterator(it, 0ull);
   }
   const_iterator Upper_bound(const key_type& key) const {
     typename tree_type::const_iterator it = tree_.Upper_bound(key);
-    return const_iterator(it, --(tree_.begin()), tree_.end(), it->begin());
+    return const_iterator(it, 0ull);
   }
 
   std::pair<iterator, iterator> Equal_range(const key_type& key) {
     std::pair<typename tree_type::iterator, typename tree_type::iterator> pair =
         tree_.Equal_range(key);
-    return std::make_pair(iterator(pair.first, --(tree_.begin()), tree_.end(),
-                                   pair.first->begin()),
-                          iterator(pair.second, --(tree_.begin()), tree_.end(),
-                                   pair.second->begin()));
+    return std::make_pair(iterator(pair.first, 0ull),
+                          iterator(pair.second, 0ull));
   }
   std::pair<const_iterator, const_iterator> Equal_range(
       const key_type& key) const {
     std::pair<typename tree_type::const_iterator,
               typename tree_type::const_iterator>
         pair = tree_.Equal_range(key);
-    return std::make_pair(const_iterator(pair.first, --(tree_.begin()),
-                                         tree_.end(), pair.first->begin()),
-                          const_iterator(pair.second, --(tree_.begin()),
-                                         tree_.end(), pair.second->begin()));
+    return std::make_pair(const_iterator(pair.first, 0ull),
+                          const_iterator(pair.second, 0ull));
   }
 
   bool Empty() const noexcept {
@@ -413,61 +1026,89 @@ class MultiTree {
     size_ = 0ull;
   }
 
-  iterator begin() {
-    typename tree_type::iterator treeIt = tree_.begin();
-    typename aggregator_type::iterator aggregatorIt = treeIt->begin();
-    return iterator(treeIt, --(tree_.begin()), tree_.end(), aggregatorIt);
-  }
-  const_iterator begin() const {
-    typename tree_type::const_iterator treeIt = tree_.begin();
-    typename aggregator_type::const_iterator aggregatorIt = treeIt->begin();
-    return const_iterator(treeIt, --(tree_.begin()), tree_.end(), aggregatorIt);
-  }
+  iterator begin() { return iterator(tree_.begin(), 0ull); }
+  const_iterator begin() const { return const_iterator(tree_.begin(), 0ull); }
   const_iterator cbegin() const { return begin(); }
-  iterator end() {
-    typename tree_type::iterator treeIt = --(tree_.end());
-    typename aggregator_type::iterator aggregatorIt = treeIt->end();
-    return iterator(tree_.end(), --(tree_.begin()), tree_.end(), aggregatorIt);
-  }
-  const_iterator end() const {
-    typename tree_type::const_iterator treeIt = --(tree_.end());
-    typename aggregator_type::const_iterator aggregatorIt = treeIt->end();
-    return const_iterator(tree_.end(), --(tree_.begin()), tree_.end(),
-                          aggregatorIt);
-  }
+  iterator end() { return iterator(tree_.end(), 0ull); }
+  const_iterator end() const { return const_iterator(tree_.end(), 0ull); }
   const_iterator cend() const { return end(); }
 
   reverse_iterator rbegin() {
+    if (tree_.Empty()) return rend();
     typename tree_type::iterator treeIt = --(tree_.end());
-    typename aggregator_type::iterator aggregatorIt = --(treeIt->end());
-    return reverse_iterator(treeIt, --(tree_.begin()), tree_.end(),
-                            aggregatorIt);
+    return reverse_iterator(treeIt, treeIt->Size() - 1ull);
   }
   const_reverse_iterator rbegin() const {
+    if (tree_.Empty()) return rend();
     typename tree_type::const_iterator treeIt = --(tree_.end());
-    typename aggregator_type::const_iterator aggregatorIt = --(treeIt->end());
-    return const_reverse_iterator(treeIt, --(tree_.begin()), tree_.end(),
-                                  aggregatorIt);
+    return const_reverse_iterator(treeIt, (*treeIt).Size() - 1ull);
   }
   const_reverse_iterator crbegin() const { return rbegin(); }
-  reverse_iterator rend() {
-    typename tree_type::iterator treeIt = tree_.begin();
-    typename aggregator_type::iterator aggregatorIt = --(treeIt->begin());
-    return reverse_iterator(--treeIt, --(tree_.begin()), tree_.end(),
-                            aggregatorIt);
-  }
+  reverse_iterator rend() { return reverse_iterator(--(tree_.begin()), 0ull); }
   const_reverse_iterator rend() const {
-    typename tree_type::const_iterator treeIt = tree_.begin();
-    typename aggregator_type::const_iterator aggregatorIt = --(treeIt->begin());
-    return const_reverse_iterator(--treeIt, --(tree_.begin()), tree_.end(),
-                                  aggregatorIt);
+    return const_reverse_iterator(--(tree_.begin()), 0ull);
   }
   const_reverse_iterator crend() const { return rend(); }
+
+ private:
+  // keys which are not less than the greatest one (timestamps, for example)
+  // go to the last group or to a new last node without any lookup
+  template <typename Type>  // const_reference or value_type&&
+  iterator insert(Type&& value) {
+    if (!tree_.Empty()) {
+      typename tree_type::iterator last = --(tree_.end());
+      const key_type& last_key = keyOf(*last, keyGetter_);
+      if (!comparator_(keyGetter_(value), last_key)) {
+        if (!comparator_(last_key, keyGetter_(value)))
+          return append(last, std::forward<Type>(value));
+        typename tree_type::iterator it =
+            tree_.Insert_back(make_group(std::forward<Type>(value))).first;
+        ++size_;
+        return iterator(it, 0ull);
+      }
+    }
+
+    typename tree_type::iterator it = tree_.Find(keyGetter_(value));
+    if (it != tree_.end()) return append(it, std::forward<Type>(value));
+    it = tree_.Insert(make_group(std::forward<Type>(value))).first;
+    ++size_;
+    return iterator(it, 0ull);
+  }
+
+  // the size is counted by the callers once the group is in the tree
+  template <typename Type>
+  aggregator_type make_group(Type&& value) {
+    aggregator_type result = newGroup(keyGetter_(value));
+    result.Push_back(std::forward<Type>(value));
+    return result;
+  }
+
+  aggregator_type newGroup([[maybe_unused]] const key_type& key) const {
+    if constexpr (kKeyed)
+      return aggregator_type(key, Get_allocator());
+    else
+      return aggregator_type(Get_allocator());
+  }
+
+  template <typename Type>
+  iterator append(typename tree_type::iterator it, Type&& value) {
+    it->Push_back(std::forward<Type>(value));
+    ++size_;
+    return iterator(it, it->Size() - 1ull);
+  }
+
+  bool equivalent(const key_type& key, const aggregator_type& group) const {
+    return !comparator_(key, keyOf(group, keyGetter_)) &&
+           !comparator_(keyOf(group, keyGetter_), key);
+  }
 };
 
-template <typename Key, typename Type, typename Comparator, typename GetKey>
-bool operator==(const s21::MultiTree<Key, Type, Comparator, GetKey>& left,
-                const s21::MultiTree<Key, Type, Comparator, GetKey>& right) {
+template <typename Key, typename Type, typename Comparator, typename GetKey,
+          typename Allocator, typename Group>
+bool operator==(
+    const s21::MultiTree<Key, Type, Comparator, GetKey, Allocator, Group>& left,
+    const s21::MultiTree<Key, Type, Comparator, GetKey, Allocator, Group>&
+        right) {
   if (left.Size() != right.Size()) return false;
 
   auto it_left = left.cbegin();
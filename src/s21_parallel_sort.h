@@ -0,0 +1,280 @@
+#ifndef _S21_PARALLEL_SORT_H_
+#define _S21_PARALLEL_SORT_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "s21_sort.h"
+#include "s21_utility.h"
+#include "s21_vector.h"
+
+namespace s21 {
+
+// Sorting and merging on all the cores with nothing but std::thread: the
+// work is split into one piece per thread, the calling thread takes a piece
+// too and returns when all are done. The temporary and the resulting
+// elements are made by Resize_default_init, so the elements should be
+// default constructible
+namespace par {
+
+namespace Detail {
+
+// pieces smaller than it are not worth a thread
+constexpr std::size_t kMinPiece = 1ull << 14;
+
+inline std::atomic<std::size_t>& threads() noexcept {
+  static std::atomic<std::size_t> count{0ull};
+  return count;
+}
+
+// joins the started threads however the scope is left: destroying a thread
+// which is still joinable terminates the program
+class Joiner {
+ public:
+  explicit Joiner(Vector<std::thread>& workers) noexcept : workers_{workers} {}
+  Joiner(const Joiner&) = delete;
+  Joiner& operator=(const Joiner&) = delete;
+  ~Joiner() {
+    for (auto& worker : workers_)
+      if (worker.joinable()) worker.join();
+  }
+
+ private:
+  Vector<std::thread>& workers_;
+};
+
+// function(piece) for piece in [0, count) on count threads; the first
+// exception thrown is rethrown when all of them are over. When a thread can
+// not be started, the started ones are joined and std::system_error is
+// thrown
+template <typename Function>
+void forEachPiece(std::size_t count, Function function) {
+  if (count <= 1ull) {
+    if (count) function(0ull);
+    return;
+  }
+
+  Vector<std::exception_ptr> errors(count, nullptr);
+  Vector<std::thread> workers;
+  workers.Reserve(count - 1ull);
+  auto run = [&function, &errors](std::size_t piece) {
+    try {
+      function(piece);
+    } catch (...) {
+      errors[piece] = std::current_exception();
+    }
+  };
+  {
+    Joiner joiner(workers);
+    for (std::size_t piece = 1ull; piece < count; ++piece)
+      workers.Emplace_back(run, piece);
+    run(0ull);
+  }
+
+  for (const auto& error : errors)
+    if (error) std::rethrow_exception(error);
+}
+
+// the element itself rather than the rvalue a move_iterator gives, so that
+// comparing never moves from it
+template <typename Type>
+const std::remove_reference_t<Type>& view(Type&& value) noexcept {
+  return value;
+}
+
+// how many elements of left are among the first k of the merged sequence;
+// equal elements are taken from left first
+template <typename Left, typename Right, typename Compare>
+std::size_t coRank(std::size_t k, Left left, std::size_t left_size,
+                   Right right, std::size_t right_size, Compare& compare) {
+  std::size_t i = std::min(k, left_size);
+  std::size_t j = k - i;
+  std::size_t i_low = k > right_size ? k - right_size : 0ull;
+  std::size_t j_low = k > left_size ? k - left_size : 0ull;
+
+  while (true) {
+    if (i > 0ull && j < right_size &&
+        compare(view(right[j]), view(left[i - 1ull]))) {
+      const std::size_t delta = (i - i_low + 1ull) / 2ull;
+      j_low = j;
+      i -= delta;
+      j += delta;
+    } else if (j > 0ull && i < left_size &&
+               !compare(view(right[j - 1ull]), view(left[i]))) {
+      const std::size_t delta = (j - j_low + 1ull) / 2ull;
+      i_low = i;
+      i += delta;
+      j -= delta;
+    } else {
+      return i;
+    }
+  }
+}
+
+template <typename Left, typename Right, typename Output, typename Compare>
+void mergeSequential(Left left, Left left_end, Right right, Right right_end,
+                     Output out, Compare& compare) {
+  while (left != left_end && right != right_end) {
+    if (compare(view(*right), view(*left)))
+      *out++ = *right++;
+    else
+      *out++ = *left++;
+  }
+  while (left != left_end) *out++ = *left++;
+  while (right != right_end) *out++ = *right++;
+}
+
+// stable merge of two sorted ranges into out: the output is cut into equal
+// pieces, co-ranking finds where each of them starts in both inputs. All the
+// cuts are found before any piece is merged, since merging moves from the
+// inputs which the search of another piece would read
+template <typename Left, typename Right, typename Output, typename Compare>
+void merge(Left left, std::size_t left_size, Right right,
+           std::size_t right_size, Output out, Compare compare,
+           std::size_t threads) {
+  const std::size_t size = left_size + right_size;
+  const std::size_t pieces =
+      std::max<std::size_t>(1ull, std::min(threads, size / kMinPiece));
+
+  Vector<std::size_t> cuts;
+  cuts.Reserve(pieces + 1ull);
+  for (std::size_t piece = 0ull; piece <= pieces; ++piece)
+    cuts.Push_back(coRank(size * piece / pieces, left, left_size, right,
+                          right_size, compare));
+
+  forEachPiece(pieces, [&](std::size_t piece) {
+    Compare own = compare;
+    const std::size_t begin = size * piece / pieces;
+    const std::size_t end = size * (piece + 1ull) / pieces;
+    const std::size_t i_begin = cuts[piece];
+    const std::size_t i_end = cuts[piece + 1ull];
+    mergeSequential(left + i_begin, left + i_end, right + (begin - i_begin),
+                    right + (end - i_end), out + begin, own);
+  });
+}
+
+}  // namespace Detail
+
+// threads the functions below use: Set_threads or all the cores
+inline std::size_t Threads() noexcept {
+  const std::size_t count = Detail::threads().load(std::memory_order_relaxed);
+  if (count) return count;
+  const unsigned hardware = std::thread::hardware_concurrency();
+  return hardware ? hardware : 1ull;
+}
+
+// 0 gives all the cores back
+inline void Set_threads(std::size_t count) noexcept {
+  Detail::threads().store(count, std::memory_order_relaxed);
+}
+
+// unstable: the pieces are sorted by s21::Sort at once, then merged pairwise
+// with all the threads, log2(Threads()) rounds between the range and a
+// temporary of the same size
+template <typename Iterator, typename Compare = std::less<>,
+          typename Projection = Utility::Identity>
+void Sort(Iterator first, Iterator last, Compare compare = Compare(),
+          Projection projection = Projection()) {
+  using value_type = typename std::iterator_traits<Iterator>::value_type;
+  using projected_type = SortDetail::ProjectedCompare<Compare, Projection>;
+
+  const std::size_t size = static_cast<std::size_t>(last - first);
+  const std::size_t threads = Threads();
+  const std::size_t pieces = std::min(threads, size / Detail::kMinPiece);
+  const projected_type projected(std::move(compare), std::move(projection));
+  if (pieces <= 1ull) {
+    s21::Sort(first, last, projected);
+    return;
+  }
+
+  Vector<std::size_t> bounds;
+  for (std::size_t piece = 0ull; piece <= pieces; ++piece)
+    bounds.Push_back(size * piece / pieces);
+
+  Detail::forEachPiece(pieces, [&](std::size_t piece) {
+    s21::Sort(first + bounds[piece], first + bounds[piece + 1ull], projected);
+  });
+
+  Vector<value_type> buffer;
+  buffer.Resize_default_init(size);
+
+  bool in_buffer = false;
+  while (bounds.Size() > 2ull) {
+    auto merge = [&](auto source, auto destination) {
+      Vector<std::size_t> next;
+      std::size_t run = 0ull;
+      for (; run + 2ull < bounds.Size(); run += 2ull) {
+        const std::size_t begin = bounds[run];
+        const std::size_t middle = bounds[run + 1ull];
+        const std::size_t end = bounds[run + 2ull];
+        Detail::merge(std::make_move_iterator(source + begin), middle - begin,
+                      std::make_move_iterator(source + middle), end - middle,
+                      destination + begin, projected, threads);
+        next.Push_back(begin);
+      }
+      // the odd run is moved as it is
+      for (; run + 1ull < bounds.Size(); ++run) {
+        next.Push_back(bounds[run]);
+        std::move(source + bounds[run], source + bounds[run + 1ull],
+                  destination + bounds[run]);
+      }
+      next.Push_back(size);
+      bounds = std::move(next);
+    };
+
+    if (in_buffer)
+      merge(buffer.Data(), first);
+    else
+      merge(first, buffer.Data());
+    in_buffer = !in_buffer;
+  }
+
+  if (in_buffer) std::move(buffer.Data(), buffer.Data() + size, first);
+}
+
+// stable merge of two sorted ranges into out, which has room for both
+template <typename Left, typename Right, typename Output,
+          typename Compare = std::less<>>
+void Merge(Left left_first, Left left_last, Right right_first,
+           Right right_last, Output out, Compare compare = Compare()) {
+  Detail::merge(left_first, static_cast<std::size_t>(left_last - left_first),
+                right_first,
+                static_cast<std::size_t>(right_last - right_first), out,
+                std::move(compare), Threads());
+}
+
+// the same over containers with Data() and Size(): Vector, Array ...
+template <typename Container, typename Compare = std::less<>,
+          typename Projection = Utility::Identity,
+          typename = decltype(std::declval<Container&>().Data())>
+void Sort(Container& container, Compare compare = Compare(),
+          Projection projection = Projection()) {
+  Sort(container.Data(), container.Data() + container.Size(),
+       std::move(compare), std::move(projection));
+}
+
+template <typename Type, typename GrowthPolicy, typename Allocator,
+          typename Compare = std::less<>>
+Vector<Type, GrowthPolicy, Allocator> Merge(
+    const Vector<Type, GrowthPolicy, Allocator>& left,
+    const Vector<Type, GrowthPolicy, Allocator>& right,
+    Compare compare = Compare()) {
+  Vector<Type, GrowthPolicy, Allocator> result(left.Get_allocator());
+  result.Resize_default_init(left.Size() + right.Size());
+  Merge(left.Data(), left.Data() + left.Size(), right.Data(),
+        right.Data() + right.Size(), result.Data(), std::move(compare));
+  return result;
+}
+
+}  // namespace par
+
+}  // namespace s21
+
+#endif  //  _S21_PARALLEL_SORT_H_
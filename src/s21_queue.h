@@ -1,6 +1,9 @@
 #ifndef _S21_QUEUE_H_
 #define _S21_QUEUE_H_
 
+#include <memory>
+#include <type_traits>
+
 #include "s21_list.h"
 
 namespace s21 {
@@ -28,6 +31,30 @@ class Queue {
   template <class InputIt>
   Queue(InputIt first, InputIt last) : queue_(first, last) {}
 
+  // the allocator is passed to the container, which should support it
+  template <class Alloc, typename = std::enable_if_t<
+                             std::uses_allocator_v<Container, Alloc>>>
+  explicit Queue(const Alloc& alloc) : queue_(alloc) {}
+  template <class Alloc, typename = std::enable_if_t<
+                             std::uses_allocator_v<Container, Alloc>>>
+  Queue(const Container& cont, const Alloc& alloc) : queue_(cont, alloc) {}
+  template <class Alloc, typename = std::enable_if_t<
+                             std::uses_allocator_v<Container, Alloc>>>
+  Queue(Container&& cont, const Alloc& alloc)
+      : queue_(std::move(cont), alloc) {}
+  template <class Alloc, typename = std::enable_if_t<
+                             std::uses_allocator_v<Container, Alloc>>>
+  Queue(const Queue& other, const Alloc& alloc) : queue_(other.queue_, alloc) {}
+  template <class Alloc, typename = std::enable_if_t<
+                             std::uses_allocator_v<Container, Alloc>>>
+  Queue(Queue&& other, const Alloc& alloc)
+      : queue_(std::move(other.queue_), alloc) {}
+  template <class InputIt, class Alloc,
+            typename = std::enable_if_t<
+                std::uses_allocator_v<Container, Alloc>>>
+  Queue(InputIt first, InputIt last, const Alloc& alloc)
+      : queue_(first, last, alloc) {}
+
   Queue& operator=(const Queue& other) = default;
   reference Front() { return *(queue_.begin()); }
   const_reference Front() const { return *(queue_.cbegin()); }
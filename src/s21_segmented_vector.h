@@ -0,0 +1,363 @@
+#ifndef _S21_SEGMENTED_VECTOR_H_
+#define _S21_SEGMENTED_VECTOR_H_
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+
+#include "s21_utility.h"
+
+namespace s21 {
+
+template <typename Vector, typename Pointer = typename Vector::pointer,
+          typename Reference = typename Vector::reference>
+class SegmentedVectorIterator {
+ public:
+  using difference_type = typename Vector::difference_type;
+  using value_type = typename Vector::value_type;
+  using pointer = Pointer;
+  using reference = Reference;
+  using iterator_category = std::random_access_iterator_tag;
+
+  template <typename VectorType, typename PointerType, typename ReferenceType>
+  friend class SegmentedVectorIterator;  // to compare const_iterator with
+                                         // iterator
+
+ private:
+  using vector_pointer =
+      std::conditional_t<std::is_const_v<std::remove_pointer_t<Pointer>>,
+                         const Vector*, Vector*>;
+
+  vector_pointer vector_;
+  typename Vector::size_type index_;
+
+ public:
+  SegmentedVectorIterator(vector_pointer vector,
+                          typename Vector::size_type index) noexcept
+      : vector_{vector}, index_{index} {}
+
+  // iterator converts to const_iterator
+  template <typename OtherPointer, typename OtherReference>
+  SegmentedVectorIterator(
+      const SegmentedVectorIterator<Vector, OtherPointer, OtherReference>&
+          other) noexcept
+      : vector_{other.vector_}, index_{other.index_} {}
+
+  reference operator*() const noexcept { return (*vector_)[index_]; }
+  pointer operator->() const noexcept { return &(*vector_)[index_]; }
+  reference operator[](difference_type n) const noexcept {
+    return (*vector_)[index_ + n];
+  }
+
+  SegmentedVectorIterator& operator++() noexcept {
+    ++index_;
+    return *this;
+  }
+  SegmentedVectorIterator operator++(int) noexcept {
+    SegmentedVectorIterator temporary(*this);
+    ++index_;
+    return temporary;
+  }
+  SegmentedVectorIterator& operator--() noexcept {
+    --index_;
+    return *this;
+  }
+  SegmentedVectorIterator operator--(int) noexcept {
+    SegmentedVectorIterator temporary(*this);
+    --index_;
+    return temporary;
+  }
+
+  SegmentedVectorIterator& operator+=(difference_type n) noexcept {
+    index_ += n;
+    return *this;
+  }
+  SegmentedVectorIterator& operator-=(difference_type n) noexcept {
+    index_ -= n;
+    return *this;
+  }
+  SegmentedVectorIterator operator+(difference_type n) const noexcept {
+    return SegmentedVectorIterator(vector_, index_ + n);
+  }
+  SegmentedVectorIterator operator-(difference_type n) const noexcept {
+    return SegmentedVectorIterator(vector_, index_ - n);
+  }
+  template <typename PointerType, typename ReferenceType>
+  difference_type operator-(
+      const SegmentedVectorIterator<Vector, PointerType, ReferenceType>& other)
+      const noexcept {
+    return static_cast<difference_type>(index_) -
+           static_cast<difference_type>(other.index_);
+  }
+
+  template <typename PointerType, typename ReferenceType>
+  bool operator==(
+      const SegmentedVectorIterator<Vector, PointerType, ReferenceType>& other)
+      const noexcept {
+    return index_ == other.index_;
+  }
+  template <typename PointerType, typename ReferenceType>
+  bool operator!=(
+      const SegmentedVectorIterator<Vector, PointerType, ReferenceType>& other)
+      const noexcept {
+    return !(*this == other);
+  }
+  template <typename PointerType, typename ReferenceType>
+  bool operator<(
+      const SegmentedVectorIterator<Vector, PointerType, ReferenceType>& other)
+      const noexcept {
+    return index_ < other.index_;
+  }
+  template <typename PointerType, typename ReferenceType>
+  bool operator>(
+      const SegmentedVectorIterator<Vector, PointerType, ReferenceType>& other)
+      const noexcept {
+    return other < *this;
+  }
+  template <typename PointerType, typename ReferenceType>
+  bool operator<=(
+      const SegmentedVectorIterator<Vector, PointerType, ReferenceType>& other)
+      const noexcept {
+    return !(other < *this);
+  }
+  template <typename PointerType, typename ReferenceType>
+  bool operator>=(
+      const SegmentedVectorIterator<Vector, PointerType, ReferenceType>& other)
+      const noexcept {
+    return !(*this < other);
+  }
+};
+
+// Vector which never relocates its elements: they are kept in blocks of
+// FirstBlock, 2 * FirstBlock, 4 * FirstBlock ... elements, and a new block
+// is added when the last one is full. Pointers, references and iterators
+// stay valid while the element exists, an index is found in O(1).
+// One writer may append while other threads read the elements below Size()
+template <typename Type, std::size_t FirstBlock = 16ull,
+          typename Allocator = std::allocator<Type>>
+class SegmentedVector : private Utility::AllocatorHolder<Allocator> {
+  using traits = std::allocator_traits<Allocator>;
+  using layout = Utility::GeometricBlocks<FirstBlock>;
+
+ public:
+  using allocator_type = Allocator;
+  using value_type = Type;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using pointer = value_type*;
+  using const_pointer = const value_type*;
+
+  using iterator = SegmentedVectorIterator<SegmentedVector>;
+  using const_iterator =
+      SegmentedVectorIterator<SegmentedVector, const_pointer, const_reference>;
+
+ private:
+  pointer blocks_[layout::kMaxBlocks];  // never moves, readers may look into it
+  size_type blocksCount_;               // blocks_ below it are allocated
+  std::atomic<size_type> size_;
+
+ public:
+  SegmentedVector() noexcept(noexcept(Allocator()))
+      : blocks_{}, blocksCount_{0ull}, size_{0ull} {}
+  explicit SegmentedVector(const Allocator& allocator) noexcept
+      : Utility::AllocatorHolder<Allocator>(allocator),
+        blocks_{},
+        blocksCount_{0ull},
+        size_{0ull} {}
+
+  SegmentedVector(size_type count, const_reference value,
+                  const Allocator& allocator = Allocator())
+      : SegmentedVector(allocator) {
+    for (size_type i = 0ull; i < count; ++i) Push_back(value);
+  }
+  SegmentedVector(std::initializer_list<value_type> list,
+                  const Allocator& allocator = Allocator())
+      : SegmentedVector(allocator) {
+    for (const auto& element : list) Push_back(element);
+  }
+
+  SegmentedVector(const SegmentedVector& other)
+      : SegmentedVector(traits::select_on_container_copy_construction(
+            other.allocator())) {
+    for (const auto& element : other) Push_back(element);
+  }
+  SegmentedVector(SegmentedVector&& other) noexcept
+      : SegmentedVector(other.allocator()) {
+    steal(other);
+  }
+
+  SegmentedVector& operator=(const SegmentedVector& other) {
+    if (this == &other) return *this;
+
+    SegmentedVector temporary(other);
+    *this = std::move(temporary);
+    return *this;
+  }
+  SegmentedVector& operator=(SegmentedVector&& other) noexcept {
+    if (this == &other) return *this;
+
+    deallocate();
+    if constexpr (traits::propagate_on_container_move_assignment::value)
+      this->allocator() = std::move(other.allocator());
+    assert(this->allocator() == other.allocator() &&
+           "Moving vectors with unequal allocators!");
+    steal(other);
+    return *this;
+  }
+
+  ~SegmentedVector() { deallocate(); }
+
+  allocator_type Get_allocator() const noexcept { return this->allocator(); }
+
+  reference operator[](size_type pos) {
+    return blocks_[layout::Block(pos)][layout::Offset(pos)];
+  }
+  const_reference operator[](size_type pos) const {
+    return blocks_[layout::Block(pos)][layout::Offset(pos)];
+  }
+
+  reference At(size_type pos) {
+    if (pos >= Size()) throw std::out_of_range("Index is out of range!");
+    return operator[](pos);
+  }
+  const_reference At(size_type pos) const {
+    if (pos >= Size()) throw std::out_of_range("Index is out of range!");
+    return operator[](pos);
+  }
+
+  reference Front() { return operator[](0ull); }
+  const_reference Front() const { return operator[](0ull); }
+  reference Back() { return operator[](Size() - 1ull); }
+  const_reference Back() const { return operator[](Size() - 1ull); }
+
+  // the elements below it are constructed and may be read by any thread
+  size_type Size() const noexcept {
+    return size_.load(std::memory_order_acquire);
+  }
+  bool Empty() const noexcept { return !Size(); }
+  size_type Capacity() const noexcept { return layout::Start(blocksCount_); }
+
+  iterator begin() noexcept { return iterator(this, 0ull); }
+  const_iterator begin() const noexcept { return cbegin(); }
+  const_iterator cbegin() const noexcept { return const_iterator(this, 0ull); }
+  iterator end() noexcept { return iterator(this, Size()); }
+  const_iterator end() const noexcept { return cend(); }
+  const_iterator cend() const noexcept { return const_iterator(this, Size()); }
+
+  void Push_back(const_reference value) { Emplace_back(value); }
+  void Push_back(value_type&& value) { Emplace_back(std::move(value)); }
+
+  // the element is published to the readers only when it is constructed
+  template <typename... Args>
+  reference Emplace_back(Args&&... args) {
+    const size_type index = size_.load(std::memory_order_relaxed);
+    const size_type k = layout::Block(index);
+    if (k == blocksCount_) {
+      blocks_[k] = traits::allocate(this->allocator(), layout::Size(k));
+      ++blocksCount_;
+    }
+    pointer element = blocks_[k] + layout::Offset(index);
+    traits::construct(this->allocator(), element, std::forward<Args>(args)...);
+    size_.store(index + 1ull, std::memory_order_release);
+    return *element;
+  }
+
+  void Pop_back() {
+    const size_type size = size_.load(std::memory_order_relaxed);
+    assert(size && "Pop_back from empty vector!");
+    size_.store(size - 1ull, std::memory_order_release);
+    traits::destroy(this->allocator(), &operator[](size - 1ull));
+  }
+
+  // blocks are allocated ahead, none of the elements moves
+  void Reserve(size_type new_capacity) {
+    while (Capacity() < new_capacity) {
+      blocks_[blocksCount_] =
+          traits::allocate(this->allocator(), layout::Size(blocksCount_));
+      ++blocksCount_;
+    }
+  }
+
+  // releases the blocks with no elements
+  void Shrink_to_fit() {
+    const size_type size = Size();
+    while (blocksCount_ && layout::Start(blocksCount_ - 1ull) >= size) {
+      --blocksCount_;
+      traits::deallocate(this->allocator(), blocks_[blocksCount_],
+                         layout::Size(blocksCount_));
+      blocks_[blocksCount_] = nullptr;
+    }
+  }
+
+  void Clear() noexcept { deallocate(); }
+
+  void Swap(SegmentedVector& other) noexcept {
+    if (this == &other) return;
+    using std::swap;  // to enable ADL
+    if constexpr (traits::propagate_on_container_swap::value)
+      swap(this->allocator(), other.allocator());
+    else
+      assert(this->allocator() == other.allocator() &&
+             "Swapping vectors with unequal allocators!");
+    for (size_type k = 0ull; k < layout::kMaxBlocks; ++k)
+      swap(blocks_[k], other.blocks_[k]);
+    swap(blocksCount_, other.blocksCount_);
+    const size_type size = Size();
+    size_.store(other.Size(), std::memory_order_release);
+    other.size_.store(size, std::memory_order_release);
+  }
+
+ private:
+  void deallocate() noexcept {
+    const size_type size = Size();
+    for (size_type i = 0ull; i < size; ++i)
+      traits::destroy(this->allocator(), &operator[](i));
+    for (size_type k = 0ull; k < blocksCount_; ++k) {
+      traits::deallocate(this->allocator(), blocks_[k], layout::Size(k));
+      blocks_[k] = nullptr;
+    }
+    blocksCount_ = 0ull;
+    size_.store(0ull, std::memory_order_release);
+  }
+
+  // this should be empty, the allocators should be equal
+  void steal(SegmentedVector& other) noexcept {
+    for (size_type k = 0ull; k < other.blocksCount_; ++k) {
+      blocks_[k] = other.blocks_[k];
+      other.blocks_[k] = nullptr;
+    }
+    blocksCount_ = other.blocksCount_;
+    size_.store(other.Size(), std::memory_order_release);
+
+    other.blocksCount_ = 0ull;
+    other.size_.store(0ull, std::memory_order_release);
+  }
+};
+
+template <typename Type, std::size_t FirstBlock, typename Allocator>
+bool operator==(const SegmentedVector<Type, FirstBlock, Allocator>& left,
+                const SegmentedVector<Type, FirstBlock, Allocator>& right) {
+  if (left.Size() != right.Size()) return false;
+
+  for (std::size_t i = 0ull; i < left.Size(); ++i)
+    if (left[i] != right[i]) return false;
+
+  return true;
+}
+
+template <typename Type, std::size_t FirstBlock, typename Allocator>
+bool operator!=(const SegmentedVector<Type, FirstBlock, Allocator>& left,
+                const SegmentedVector<Type, FirstBlock, Allocator>& right) {
+  return !(left == right);
+}
+
+}  // namespace s21
+
+#endif  //  _S21_SEGMENTED_VECTOR_H_
@@ -1,23 +1,27 @@
 #ifndef _S21_SET_H_
 #define _S21_SET_H_
 
+#include <memory>
+#include <memory_resource>
+
 #include "s21_tree.h"
 #include "s21_utility.h"
 
 namespace s21 {
 
-template <typename Value, typename Comparator = Utility::Less<Value>>
-class Set : public Tree::Tree<Value, Value, Comparator> {
-  using Base = Tree::Tree<Value, Value, Comparator>;
+template <typename Value, typename Comparator = Utility::Less<Value>,
+          typename Allocator = std::allocator<Value>>
+class Set : public Tree::Tree<Value, Value, Comparator, Allocator> {
+  using Base = Tree::Tree<Value, Value, Comparator, Allocator>;
 
  public:
   using node_type = typename Base::node_handler;
   using Base::Base;
 };
 
-template <typename Type, typename Comperator>
-bool operator==(const s21::Set<Type, Comperator>& left,
-                const s21::Set<Type, Comperator>& right) {
+template <typename Type, typename Comperator, typename Allocator>
+bool operator==(const s21::Set<Type, Comperator, Allocator>& left,
+                const s21::Set<Type, Comperator, Allocator>& right) {
   if (left.Size() != right.Size()) return false;
 
   auto s21_it = left.cbegin();
@@ -33,6 +37,13 @@ bool operator==(const s21::Set<Type, Comperator>& left,
   return true;
 }
 
+namespace pmr {
+
+template <typename Value, typename Comparator = Utility::Less<Value>>
+using Set = s21::Set<Value, Comparator, std::pmr::polymorphic_allocator<Value>>;
+
+}  // namespace pmr
+
 }  // namespace s21
 
 #endif  //  _S21_SET_H_
\ No newline at end of file
@@ -0,0 +1,371 @@
+#ifndef _S21_SIMD_H_
+#define _S21_SIMD_H_
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+// Vectorized kernels over contiguous data: Vector::Data(), Array::Data() or
+// any pointer. Every kernel is one portable loop written so that compilers
+// vectorize it (independent lanes, no early exit inside a block), and it is
+// compiled once more for each instruction set below; the best one the CPU
+// supports is picked at run time. Without GCC or Clang on x86 only the
+// scalar build is there
+
+#if (defined(__GNUC__) || defined(__clang__)) && \
+    (defined(__x86_64__) || defined(__i386__))
+#define S21_SIMD_X86 1
+#define S21_SIMD_INLINE __attribute__((always_inline)) inline
+#else
+#define S21_SIMD_INLINE inline
+#endif
+
+// a loop over one block which should stay a loop: GCC unrolls the short
+// ones completely before the vectorizer runs and then does not vectorize
+// the reductions they make
+#if defined(__GNUC__) && !defined(__clang__)
+#define S21_SIMD_BLOCK _Pragma("GCC unroll 1")
+#else
+#define S21_SIMD_BLOCK
+#endif
+
+namespace s21 {
+
+namespace simd {
+
+enum class Level { kScalar, kSse2, kAvx2, kAvx512 };
+
+// the best level this CPU supports
+inline Level Detected() noexcept {
+#ifdef S21_SIMD_X86
+  static const Level level = [] {
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") &&
+        __builtin_cpu_supports("avx512bw"))
+      return Level::kAvx512;
+    if (__builtin_cpu_supports("avx2")) return Level::kAvx2;
+    if (__builtin_cpu_supports("sse2")) return Level::kSse2;
+    return Level::kScalar;
+  }();
+  return level;
+#else
+  return Level::kScalar;
+#endif
+}
+
+namespace Detail {
+
+inline Level& active() noexcept {
+  static Level level = Detected();
+  return level;
+}
+
+// one 512-bit register of elements, the widest target
+template <typename Type>
+constexpr std::size_t kLanes = 64ull / sizeof(Type);
+
+// an unsigned integer as wide as Type: comparisons of a block are or-ed in
+// it, one vector lane each
+template <typename Type>
+using Mask = std::conditional_t<
+    sizeof(Type) == 1ull, std::uint8_t,
+    std::conditional_t<
+        sizeof(Type) == 2ull, std::uint16_t,
+        std::conditional_t<sizeof(Type) == 4ull, std::uint32_t,
+                           std::uint64_t>>>;
+
+// integers are summed in 64 bits not to overflow
+template <typename Type>
+using Accumulator = std::conditional_t<
+    std::is_floating_point_v<Type>, Type,
+    std::conditional_t<std::is_signed_v<Type>, std::int64_t, std::uint64_t>>;
+
+struct FindKernel {
+  template <typename Type>
+  static S21_SIMD_INLINE std::size_t Run(const Type* data, std::size_t count,
+                                         Type value) {
+    constexpr std::size_t lanes = kLanes<Type>;
+    std::size_t i = 0ull;
+    for (; i + lanes <= count; i += lanes) {
+      Mask<Type> found = 0u;
+      S21_SIMD_BLOCK
+      for (std::size_t j = 0ull; j < lanes; ++j) found |= data[i + j] == value;
+      if (found) break;
+    }
+    for (; i < count; ++i)
+      if (data[i] == value) return i;
+    return count;
+  }
+};
+
+struct CountKernel {
+  template <typename Type>
+  static S21_SIMD_INLINE std::size_t Run(const Type* data, std::size_t count,
+                                         Type value) {
+    constexpr std::size_t lanes = kLanes<Type>;
+    std::size_t counters[lanes] = {};
+    std::size_t i = 0ull;
+    for (; i + lanes <= count; i += lanes)
+      for (std::size_t j = 0ull; j < lanes; ++j)
+        counters[j] += data[i + j] == value;
+
+    std::size_t result = 0ull;
+    for (std::size_t j = 0ull; j < lanes; ++j) result += counters[j];
+    for (; i < count; ++i) result += data[i] == value;
+    return result;
+  }
+};
+
+struct SumKernel {
+  template <typename Type>
+  static S21_SIMD_INLINE Accumulator<Type> Run(const Type* data,
+                                               std::size_t count) {
+    constexpr std::size_t lanes = kLanes<Type>;
+    Accumulator<Type> sums[lanes] = {};
+    std::size_t i = 0ull;
+    for (; i + lanes <= count; i += lanes)
+      for (std::size_t j = 0ull; j < lanes; ++j) sums[j] += data[i + j];
+
+    Accumulator<Type> result{};
+    for (std::size_t j = 0ull; j < lanes; ++j) result += sums[j];
+    for (; i < count; ++i) result += data[i];
+    return result;
+  }
+};
+
+struct DotKernel {
+  template <typename Type>
+  static S21_SIMD_INLINE Accumulator<Type> Run(const Type* left,
+                                               const Type* right,
+                                               std::size_t count) {
+    constexpr std::size_t lanes = kLanes<Type>;
+    Accumulator<Type> sums[lanes] = {};
+    std::size_t i = 0ull;
+    for (; i + lanes <= count; i += lanes)
+      for (std::size_t j = 0ull; j < lanes; ++j)
+        sums[j] += static_cast<Accumulator<Type>>(left[i + j]) *
+                   static_cast<Accumulator<Type>>(right[i + j]);
+
+    Accumulator<Type> result{};
+    for (std::size_t j = 0ull; j < lanes; ++j) result += sums[j];
+    for (; i < count; ++i)
+      result += static_cast<Accumulator<Type>>(left[i]) *
+                static_cast<Accumulator<Type>>(right[i]);
+    return result;
+  }
+};
+
+struct MinKernel {
+  template <typename Type>
+  static S21_SIMD_INLINE Type Run(const Type* data, std::size_t count) {
+    constexpr std::size_t lanes = kLanes<Type>;
+    Type result = data[0];
+    std::size_t i = 0ull;
+    if (count >= lanes) {
+      Type minimums[lanes];
+      for (std::size_t j = 0ull; j < lanes; ++j) minimums[j] = data[j];
+      for (i = lanes; i + lanes <= count; i += lanes)
+        for (std::size_t j = 0ull; j < lanes; ++j)
+          minimums[j] = data[i + j] < minimums[j] ? data[i + j] : minimums[j];
+      for (std::size_t j = 0ull; j < lanes; ++j)
+        result = minimums[j] < result ? minimums[j] : result;
+    }
+    for (; i < count; ++i) result = data[i] < result ? data[i] : result;
+    return result;
+  }
+};
+
+struct MaxKernel {
+  template <typename Type>
+  static S21_SIMD_INLINE Type Run(const Type* data, std::size_t count) {
+    constexpr std::size_t lanes = kLanes<Type>;
+    Type result = data[0];
+    std::size_t i = 0ull;
+    if (count >= lanes) {
+      Type maximums[lanes];
+      for (std::size_t j = 0ull; j < lanes; ++j) maximums[j] = data[j];
+      for (i = lanes; i + lanes <= count; i += lanes)
+        for (std::size_t j = 0ull; j < lanes; ++j)
+          maximums[j] = maximums[j] < data[i + j] ? data[i + j] : maximums[j];
+      for (std::size_t j = 0ull; j < lanes; ++j)
+        result = result < maximums[j] ? maximums[j] : result;
+    }
+    for (; i < count; ++i) result = result < data[i] ? data[i] : result;
+    return result;
+  }
+};
+
+struct MismatchKernel {
+  template <typename Type>
+  static S21_SIMD_INLINE std::size_t Run(const Type* left, const Type* right,
+                                         std::size_t count) {
+    constexpr std::size_t lanes = kLanes<Type>;
+    std::size_t i = 0ull;
+    for (; i + lanes <= count; i += lanes) {
+      Mask<Type> differs = 0u;
+      S21_SIMD_BLOCK
+      for (std::size_t j = 0ull; j < lanes; ++j)
+        differs |= left[i + j] != right[i + j];
+      if (differs) break;
+    }
+    for (; i < count; ++i)
+      if (left[i] != right[i]) return i;
+    return count;
+  }
+};
+
+// the same kernel built for each instruction set
+template <typename Kernel, typename... Args>
+auto runScalar(Args... args) {
+  return Kernel::Run(args...);
+}
+
+#ifdef S21_SIMD_X86
+template <typename Kernel, typename... Args>
+__attribute__((target("sse2"))) auto runSse2(Args... args) {
+  return Kernel::Run(args...);
+}
+
+template <typename Kernel, typename... Args>
+__attribute__((target("avx2"))) auto runAvx2(Args... args) {
+  return Kernel::Run(args...);
+}
+
+template <typename Kernel, typename... Args>
+__attribute__((target("avx512f,avx512bw"))) auto runAvx512(Args... args) {
+  return Kernel::Run(args...);
+}
+#endif
+
+template <typename Kernel, typename... Args>
+auto dispatch(Args... args) {
+#ifdef S21_SIMD_X86
+  switch (active()) {
+    case Level::kAvx512:
+      return runAvx512<Kernel>(args...);
+    case Level::kAvx2:
+      return runAvx2<Kernel>(args...);
+    case Level::kSse2:
+      return runSse2<Kernel>(args...);
+    case Level::kScalar:
+      break;
+  }
+#endif
+  return runScalar<Kernel>(args...);
+}
+
+template <typename Type>
+constexpr bool kSupported = std::is_arithmetic_v<Type>;
+
+}  // namespace Detail
+
+// the level the kernels run with
+inline Level Active() noexcept { return Detail::active(); }
+
+// makes the kernels run with level, at most the Detected() one; for tests
+// and comparisons. Not to be called while kernels run in other threads
+inline void Set_level(Level level) noexcept {
+  Detail::active() = std::min(level, Detected());
+}
+
+// the index of the first element equal to value or count; memchr for bytes
+template <typename Type>
+std::size_t Find(const Type* data, std::size_t count, Type value) {
+  static_assert(Detail::kSupported<Type>, "Arithmetic types only!");
+  return Detail::dispatch<Detail::FindKernel>(data, count, value);
+}
+
+template <typename Type>
+std::size_t Count(const Type* data, std::size_t count, Type value) {
+  static_assert(Detail::kSupported<Type>, "Arithmetic types only!");
+  return Detail::dispatch<Detail::CountKernel>(data, count, value);
+}
+
+// integers are summed as 64-bit ones; floating point sums are reassociated,
+// so they may differ from a plain loop in the last bits
+template <typename Type>
+Detail::Accumulator<Type> Sum(const Type* data, std::size_t count) {
+  static_assert(Detail::kSupported<Type>, "Arithmetic types only!");
+  return Detail::dispatch<Detail::SumKernel>(data, count);
+}
+
+template <typename Type>
+Detail::Accumulator<Type> Dot(const Type* left, const Type* right,
+                              std::size_t count) {
+  static_assert(Detail::kSupported<Type>, "Arithmetic types only!");
+  return Detail::dispatch<Detail::DotKernel>(left, right, count);
+}
+
+// count should not be zero; NaNs are not looked for
+template <typename Type>
+Type Min(const Type* data, std::size_t count) {
+  static_assert(Detail::kSupported<Type>, "Arithmetic types only!");
+  assert(count && "Min of nothing!");
+  return Detail::dispatch<Detail::MinKernel>(data, count);
+}
+
+template <typename Type>
+Type Max(const Type* data, std::size_t count) {
+  static_assert(Detail::kSupported<Type>, "Arithmetic types only!");
+  assert(count && "Max of nothing!");
+  return Detail::dispatch<Detail::MaxKernel>(data, count);
+}
+
+// the index of the first pair of different elements or count
+template <typename Type>
+std::size_t Mismatch(const Type* left, const Type* right, std::size_t count) {
+  static_assert(Detail::kSupported<Type>, "Arithmetic types only!");
+  return Detail::dispatch<Detail::MismatchKernel>(left, right, count);
+}
+
+// the same over a container with Data() and Size(): Vector, Array ...
+template <typename Container>
+std::size_t Find(const Container& container,
+                 typename Container::value_type value) {
+  return Find(container.Data(), container.Size(), value);
+}
+
+template <typename Container>
+std::size_t Count(const Container& container,
+                  typename Container::value_type value) {
+  return Count(container.Data(), container.Size(), value);
+}
+
+template <typename Container>
+auto Sum(const Container& container) {
+  return Sum(container.Data(), container.Size());
+}
+
+template <typename Container>
+auto Dot(const Container& left, const Container& right) {
+  assert(left.Size() == right.Size() && "Containers of different sizes!");
+  return Dot(left.Data(), right.Data(), left.Size());
+}
+
+template <typename Container>
+auto Min(const Container& container) {
+  return Min(container.Data(), container.Size());
+}
+
+template <typename Container>
+auto Max(const Container& container) {
+  return Max(container.Data(), container.Size());
+}
+
+template <typename Container>
+bool Equal(const Container& left, const Container& right) {
+  return left.Size() == right.Size() &&
+         Mismatch(left.Data(), right.Data(), left.Size()) == left.Size();
+}
+
+}  // namespace simd
+
+}  // namespace s21
+
+#undef S21_SIMD_INLINE
+#undef S21_SIMD_BLOCK
+#undef S21_SIMD_X86
+
+#endif  //  _S21_SIMD_H_
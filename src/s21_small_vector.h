@@ -0,0 +1,448 @@
+#ifndef _S21_SMALL_VECTOR_H_
+#define _S21_SMALL_VECTOR_H_
+
+#include <cassert>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+
+#include "s21_utility.h"
+#include "s21_vector.h"
+
+namespace s21 {
+
+// Vector which keeps up to N elements right inside the object and allocates
+// only when more of them are needed. Iterators and methods are the ones of
+// Vector; Capacity() is never less than N
+template <typename Type, std::size_t N,
+          typename GrowthPolicy = Growth::PowerOfTwo,
+          typename Allocator = std::allocator<Type>>
+class SmallVector
+    : private Utility::AllocatorHolder<Allocator>,
+      private VectorDetail::Modifiers<
+          SmallVector<Type, N, GrowthPolicy, Allocator>, Type, Allocator> {
+  static_assert(N > 0ull, "At least one element should fit inline!");
+
+  using traits = std::allocator_traits<Allocator>;
+  friend VectorDetail::Modifiers<SmallVector, Type, Allocator>;
+
+ public:
+  using allocator_type = Allocator;
+  using value_type = Type;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using pointer = value_type*;
+  using const_pointer = const value_type*;
+
+  using iterator = VectorIterator<SmallVector>;
+  using const_iterator =
+      VectorIterator<SmallVector, const_pointer, const_reference>;
+  using reverse_iterator = VectorReverseIterator<SmallVector>;
+  using const_reverse_iterator =
+      VectorReverseIterator<SmallVector, const_pointer, const_reference>;
+
+ private:
+  alignas(value_type) char storage_[N * sizeof(value_type)];
+  size_type capacity_;  // N while the elements are inline
+  size_type size_;
+  pointer data_;  // storage_ or the allocated chunk
+
+ public:
+  SmallVector() noexcept(noexcept(Allocator()))
+      : capacity_{N}, size_{0ull}, data_{inlineData()} {}
+  explicit SmallVector(const Allocator& allocator) noexcept
+      : Utility::AllocatorHolder<Allocator>(allocator),
+        capacity_{N},
+        size_{0ull},
+        data_{inlineData()} {}
+
+  explicit SmallVector(size_type count, const_reference value,
+                       const Allocator& allocator = Allocator())
+      : SmallVector(allocator) {
+    allocate(count);
+    for (; size_ < count; ++size_)
+      traits::construct(this->allocator(), data_ + size_, value);
+  }
+  ~SmallVector() { deallocate(); }
+
+  SmallVector(std::initializer_list<value_type> initializer,
+              const Allocator& allocator = Allocator())
+      : SmallVector(allocator) {
+    allocate(initializer.size());
+    for (auto&& element : initializer) {
+      traits::construct(this->allocator(), data_ + size_, std::move(element));
+      ++size_;
+    }
+  }
+
+  SmallVector(SmallVector&& other) noexcept(
+      std::is_nothrow_move_constructible_v<value_type>)
+      : SmallVector(other.allocator()) {
+    steal(other);
+  }
+  // memory of other is taken only when it can be freed with the allocator,
+  // otherwise the elements are moved one by one
+  SmallVector(SmallVector&& other, const Allocator& allocator)
+      : SmallVector(allocator) {
+    if (this->allocator() == other.allocator()) {
+      steal(other);
+      return;
+    }
+    allocate(other.size_);
+    for (; size_ < other.size_; ++size_)
+      traits::construct(this->allocator(), data_ + size_,
+                        std::move(other.data_[size_]));
+  }
+
+  SmallVector(const SmallVector& other)
+      : SmallVector(other, traits::select_on_container_copy_construction(
+                               other.allocator())) {}
+  SmallVector(const SmallVector& other, const Allocator& allocator)
+      : SmallVector(allocator) {
+    allocate(other.size_);
+    for (; size_ < other.size_; ++size_)
+      traits::construct(this->allocator(), data_ + size_, other.data_[size_]);
+  }
+
+  template <typename InputIt>
+  SmallVector(InputIt first, InputIt last,
+              const Allocator& allocator = Allocator())
+      : SmallVector(allocator) {
+    allocate(getDistance(first, last));
+    for (; first != last; ++first, ++size_)
+      traits::construct(this->allocator(), data_ + size_, *first);
+  }
+
+  SmallVector& operator=(const SmallVector& other) {
+    if (this == &other) return *this;
+
+    constexpr bool propagate =
+        traits::propagate_on_container_copy_assignment::value;
+    SmallVector temporary(other,
+                          propagate ? other.allocator() : this->allocator());
+    deallocate();
+    if constexpr (propagate) this->allocator() = temporary.allocator();
+    steal(temporary);
+    return *this;
+  }
+
+  SmallVector& operator=(SmallVector&& other) noexcept(
+      (traits::propagate_on_container_move_assignment::value ||
+       traits::is_always_equal::value) &&
+      std::is_nothrow_move_constructible_v<value_type>) {
+    if (this == &other) return *this;
+
+    if constexpr (!traits::propagate_on_container_move_assignment::value) {
+      if (this->allocator() != other.allocator()) {
+        SmallVector temporary(std::move(other), this->allocator());
+        deallocate();
+        steal(temporary);
+        return *this;
+      }
+    }
+
+    deallocate();
+    if constexpr (traits::propagate_on_container_move_assignment::value)
+      this->allocator() = std::move(other.allocator());
+    steal(other);
+
+    return *this;
+  }
+
+  allocator_type Get_allocator() const noexcept { return this->allocator(); }
+
+  void Assign(size_type count, const_reference value) {
+    SmallVector temporary(count, value, this->allocator());
+    *this = std::move(temporary);
+  }
+
+  template <typename InputIt>
+  void Assign(InputIt first, InputIt last) {
+    SmallVector temporary(first, last, this->allocator());
+    *this = std::move(temporary);
+  }
+
+  void Assign(std::initializer_list<value_type> list) {
+    SmallVector temporary(std::move(list), this->allocator());
+    *this = std::move(temporary);
+  }
+
+  reference At(size_type pos) {
+    if (pos >= size_) throw std::out_of_range("Index is out of range!");
+    return operator[](pos);
+  }
+  const_reference At(size_type pos) const {
+    if (pos >= size_) throw std::out_of_range("Index is out of range!");
+    return operator[](pos);
+  }
+
+  reference operator[](size_type pos) { return data_[pos]; }
+  const_reference operator[](size_type pos) const { return data_[pos]; }
+
+  reference Front() { return data_[0ull]; }
+  const_reference Front() const { return data_[0ull]; }
+
+  reference Back() { return data_[size_ - 1ull]; }
+  const_reference Back() const { return data_[size_ - 1ull]; }
+
+  pointer Data() noexcept { return data_; }
+  const_pointer Data() const noexcept { return data_; }
+
+  size_type Size() const noexcept { return size_; }
+  size_type Capacity() const noexcept { return capacity_; }
+
+  // bytes allocated but not used by elements, the inline storage is not
+  // counted
+  size_type Capacity_waste() const noexcept {
+    return spilled() ? (capacity_ - size_) * sizeof(value_type) : 0ull;
+  }
+
+  // true while no memory is allocated
+  bool Inline() const noexcept { return !spilled(); }
+
+  // exactly new_capacity, the growth policy is not applied
+  void Reserve(size_type new_capacity) {
+    if (new_capacity <= capacity_) return;
+    reallocate(new_capacity);
+  }
+
+  // gets back inline when the elements fit
+  void Shrink_to_fit() {
+    if (capacity_ > size_ && spilled()) reallocate(size_);
+  }
+
+  void Clear() { deallocate(); }
+
+  bool Empty() const noexcept { return size_ == 0ull; }
+
+  iterator begin() { return iterator(data_); }
+  const_iterator begin() const { return const_iterator(data_); }
+
+  const_iterator cbegin() const { return const_iterator(data_); }
+
+  reverse_iterator rbegin() { return reverse_iterator(data_ + size_ - 1ull); }
+  const_reverse_iterator rbegin() const { return crbegin(); }
+  const_reverse_iterator crbegin() const {
+    return const_reverse_iterator(data_ + size_ - 1ull);
+  }
+
+  iterator end() { return iterator(data_ + size_); }
+  const_iterator end() const { return cend(); }
+  const_iterator cend() const { return const_iterator(data_ + size_); }
+
+  reverse_iterator rend() { return reverse_iterator(data_ - 1ull); }
+  const_reverse_iterator rend() const { return crend(); }
+  const_reverse_iterator crend() const {
+    return const_reverse_iterator(data_ - 1ull);
+  }
+
+  iterator Insert(const_iterator pos, const_reference value) {
+    return Insert(pos, 1ull, value);
+  }
+
+  iterator Insert(const_iterator pos, value_type&& value) {
+    return Emplace(pos, std::move(value));
+  }
+
+  iterator Insert(const_iterator pos, size_type count, const_reference value) {
+    return iterator(this->insertCopies(pos - cbegin(), count, value));
+  }
+
+  template <class InputIt>
+  iterator Insert(const_iterator pos, InputIt first, InputIt last) {
+    return iterator(
+        this->insertRange(pos - cbegin(), first, getDistance(first, last)));
+  }
+
+  iterator Insert(const_iterator pos, std::initializer_list<value_type> list) {
+    return Insert(pos, list.begin(), list.end());
+  }
+
+  // grows once for all of args
+  template <class... Args>
+  void Insert_many_back(Args&&... args) {
+    Insert_many(cend(), std::forward<Args>(args)...);
+  }
+
+  // the elements are constructed right in their places, returns the position
+  // after them like Vector
+  template <typename... Args>
+  iterator Insert_many(const_iterator pos, Args&&... args) {
+    return iterator(this->insertMany(pos - cbegin(),
+                                     std::forward<Args>(args)...) +
+                    sizeof...(Args));
+  }
+  template <typename... Args>
+  iterator Insert_many(iterator pos, Args&&... args) {
+    return Insert_many(static_cast<const_iterator>(pos),
+                       std::forward<Args>(args)...);
+  }
+
+  template <class... Args>
+  iterator Emplace(const_iterator pos, Args&&... args) {
+    return iterator(
+        this->emplace(pos - cbegin(), std::forward<Args>(args)...));
+  }
+
+  iterator Erase(const_iterator pos) {
+    return iterator(this->erase(pos - cbegin(), 1ull));
+  }
+
+  iterator Erase(const_iterator first, const_iterator last) {
+    return iterator(this->erase(first - cbegin(), last - first));
+  }
+
+  void Push_back(const_reference element) { Emplace_back(element); }
+  void Push_back(value_type&& element) { Emplace_back(std::move(element)); }
+
+  void Pop_back() {
+    assert(size_ && "Pop_back from empty vector!");
+    traits::destroy(this->allocator(), data_ + size_ - 1ull);
+    --size_;
+  }
+
+  // new elements are value-initialized: zeros for arithmetic types
+  void Resize(size_type count) {
+    this->resize(count, [this](pointer element) {
+      traits::construct(this->allocator(), element);
+    });
+  }
+  void Resize(size_type count, const_reference value) {
+    this->resize(count, [this, &value](pointer element) {
+      traits::construct(this->allocator(), element, value);
+    });
+  }
+
+  // args may refer to the elements of this very vector
+  template <typename... Args>
+  reference Emplace_back(Args&&... args) {
+    return *this->emplace(size_, std::forward<Args>(args)...);
+  }
+
+  void Swap(SmallVector& other) {
+    if (this == &other) return;
+    using namespace std;  // to enable ADL
+    if constexpr (traits::propagate_on_container_swap::value)
+      swap(this->allocator(), other.allocator());
+    else
+      assert(this->allocator() == other.allocator() &&
+             "Swapping vectors with unequal allocators!");
+
+    if (spilled() && other.spilled()) {
+      swap(data_, other.data_);
+      swap(size_, other.size_);
+      swap(capacity_, other.capacity_);
+      return;
+    }
+    // inline elements can not change hands, they are relocated
+    SmallVector temporary(this->allocator());
+    temporary.steal(other);
+    other.steal(*this);
+    steal(temporary);
+  }
+
+ private:
+  pointer inlineData() noexcept { return reinterpret_cast<pointer>(storage_); }
+  const_pointer inlineData() const noexcept {
+    return reinterpret_cast<const_pointer>(storage_);
+  }
+
+  bool spilled() const noexcept { return data_ != inlineData(); }
+
+  static size_type calculate_capacity(size_type capacity,
+                                      size_type count) noexcept {
+    return GrowthPolicy::Next(capacity, count, sizeof(value_type));
+  }
+
+  // the empty inline vector gets room for exact_count elements
+  void allocate(size_type exact_count) {
+    assert(!size_ && !spilled() && "Possible memory leak!");
+    if (exact_count <= N) return;
+
+    // no constructors were called
+    data_ = traits::allocate(this->allocator(), exact_count);
+    capacity_ = exact_count;
+  }
+
+  // up to N elements go inline
+  void reallocate(size_type exact_count) {
+    if (exact_count <= N) {
+      if (spilled()) replace(inlineData(), N);
+      return;
+    }
+    replace(traits::allocate(this->allocator(), exact_count), exact_count);
+  }
+
+  // moves the elements to new_data releasing the old chunk, if any; when a
+  // move throws new_data is released instead
+  void replace(pointer new_data, size_type new_capacity) {
+    try {
+      Utility::Relocate(this->allocator(), data_, size_, new_data);
+    } catch (...) {
+      if (new_data != inlineData())
+        traits::deallocate(this->allocator(), new_data, new_capacity);
+      throw;
+    }
+    adopt(new_data, new_capacity);
+  }
+
+  // takes new_data of new_capacity elements instead of the memory it had
+  void adopt(pointer new_data, size_type new_capacity) noexcept {
+    if (spilled()) traits::deallocate(this->allocator(), data_, capacity_);
+    data_ = new_data;
+    capacity_ = new_capacity;
+  }
+
+  void deallocate() noexcept {
+    for (size_type i = 0ull; i < size_; ++i)
+      traits::destroy(this->allocator(), data_ + i);
+    if (spilled()) traits::deallocate(this->allocator(), data_, capacity_);
+    data_ = inlineData();
+    capacity_ = N;
+    size_ = 0ull;
+  }
+
+  // this should be empty and inline, the allocators should be equal;
+  // other is left empty and inline
+  void steal(SmallVector& other) noexcept(
+      std::is_nothrow_move_constructible_v<value_type>) {
+    if (other.spilled()) {
+      data_ = other.data_;
+      capacity_ = other.capacity_;
+    } else {
+      Utility::Relocate(this->allocator(), other.data_, other.size_, data_);
+    }
+    size_ = other.size_;
+
+    other.data_ = other.inlineData();
+    other.capacity_ = N;
+    other.size_ = 0ull;
+  }
+
+  template <class InputIt>
+  static size_type getDistance(InputIt first, InputIt last) noexcept {
+    return static_cast<size_type>(std::distance(first, last));
+  }
+};
+
+template <typename Type, std::size_t N, typename GrowthPolicy,
+          typename Allocator>
+bool operator==(const SmallVector<Type, N, GrowthPolicy, Allocator>& left,
+                const SmallVector<Type, N, GrowthPolicy, Allocator>& right) {
+  return VectorDetail::Equal(left, right);
+}
+
+template <typename Type, std::size_t N, typename GrowthPolicy,
+          typename Allocator>
+bool operator!=(const SmallVector<Type, N, GrowthPolicy, Allocator>& left,
+                const SmallVector<Type, N, GrowthPolicy, Allocator>& right) {
+  return !(left == right);
+}
+
+}  // namespace s21
+
+#endif  //  _S21_SMALL_VECTOR_H_
@@ -0,0 +1,310 @@
+#ifndef _S21_SOA_VECTOR_H_
+#define _S21_SOA_VECTOR_H_
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "s21_vector.h"
+
+namespace s21 {
+
+// Iterator over the rows of SoAVector: the vector and the index of the row.
+// Dereferencing gives a tuple of references into the columns
+template <typename SoAVector, typename Reference>
+class SoAVectorIterator {
+ public:
+  using difference_type = typename SoAVector::difference_type;
+  using value_type = typename SoAVector::value_type;
+  using pointer = void;
+  using reference = Reference;
+  using iterator_category = std::random_access_iterator_tag;
+
+  template <typename VectorType, typename ReferenceType>
+  friend class SoAVectorIterator;  // to compare const_iterator with iterator
+
+ private:
+  SoAVector* vector_;
+  typename SoAVector::size_type index_;
+
+ public:
+  SoAVectorIterator(SoAVector* vector,
+                    typename SoAVector::size_type index) noexcept
+      : vector_{vector}, index_{index} {}
+
+  // iterator converts to const_iterator
+  template <typename VectorType, typename ReferenceType>
+  SoAVectorIterator(
+      const SoAVectorIterator<VectorType, ReferenceType>& other) noexcept
+      : vector_{other.vector_}, index_{other.index_} {}
+
+  reference operator*() const { return (*vector_)[index_]; }
+  reference operator[](difference_type n) const {
+    return (*vector_)[index_ + n];
+  }
+  typename SoAVector::size_type Index() const noexcept { return index_; }
+
+  SoAVectorIterator& operator++() noexcept {
+    ++index_;
+    return *this;
+  }
+  SoAVectorIterator operator++(int) noexcept {
+    SoAVectorIterator temporary(*this);
+    ++index_;
+    return temporary;
+  }
+  SoAVectorIterator& operator--() noexcept {
+    --index_;
+    return *this;
+  }
+  SoAVectorIterator operator--(int) noexcept {
+    SoAVectorIterator temporary(*this);
+    --index_;
+    return temporary;
+  }
+
+  SoAVectorIterator& operator+=(difference_type n) noexcept {
+    index_ += n;
+    return *this;
+  }
+  SoAVectorIterator& operator-=(difference_type n) noexcept {
+    index_ -= n;
+    return *this;
+  }
+  SoAVectorIterator operator+(difference_type n) const noexcept {
+    return SoAVectorIterator(vector_, index_ + n);
+  }
+  SoAVectorIterator operator-(difference_type n) const noexcept {
+    return SoAVectorIterator(vector_, index_ - n);
+  }
+  template <typename VectorType, typename ReferenceType>
+  difference_type operator-(
+      const SoAVectorIterator<VectorType, ReferenceType>& other)
+      const noexcept {
+    return static_cast<difference_type>(index_) -
+           static_cast<difference_type>(other.index_);
+  }
+
+  template <typename VectorType, typename ReferenceType>
+  bool operator==(const SoAVectorIterator<VectorType, ReferenceType>& other)
+      const noexcept {
+    return index_ == other.index_;
+  }
+  template <typename VectorType, typename ReferenceType>
+  bool operator!=(const SoAVectorIterator<VectorType, ReferenceType>& other)
+      const noexcept {
+    return !(*this == other);
+  }
+  template <typename VectorType, typename ReferenceType>
+  bool operator<(const SoAVectorIterator<VectorType, ReferenceType>& other)
+      const noexcept {
+    return index_ < other.index_;
+  }
+  template <typename VectorType, typename ReferenceType>
+  bool operator>(const SoAVectorIterator<VectorType, ReferenceType>& other)
+      const noexcept {
+    return other < *this;
+  }
+  template <typename VectorType, typename ReferenceType>
+  bool operator<=(const SoAVectorIterator<VectorType, ReferenceType>& other)
+      const noexcept {
+    return !(other < *this);
+  }
+  template <typename VectorType, typename ReferenceType>
+  bool operator>=(const SoAVectorIterator<VectorType, ReferenceType>& other)
+      const noexcept {
+    return !(*this < other);
+  }
+};
+
+// Vector of records kept as structure of arrays: field I of every row lives
+// in its own Vector, so a loop over one field reads only that field and the
+// columns are plain arrays for vectorized kernels (Data<I>()). A row is
+// seen as a tuple of references: auto [id, x] = soa[i]
+template <typename... Fields>
+class SoAVector {
+  static_assert(sizeof...(Fields) > 0ull, "SoAVector needs a field!");
+  static_assert(!(std::is_same_v<Fields, bool> || ...),
+                "Vector<bool> is packed into bits, use std::uint8_t!");
+
+ public:
+  using value_type = std::tuple<Fields...>;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = std::tuple<Fields&...>;
+  using const_reference = std::tuple<const Fields&...>;
+
+  using iterator = SoAVectorIterator<SoAVector, reference>;
+  using const_iterator = SoAVectorIterator<const SoAVector, const_reference>;
+
+  template <std::size_t I>
+  using column_type = Vector<std::tuple_element_t<I, value_type>>;
+
+ private:
+  using indices = std::index_sequence_for<Fields...>;
+
+  std::tuple<Vector<Fields>...> columns_;
+
+ public:
+  SoAVector() = default;
+  explicit SoAVector(size_type count) { Resize(count); }
+  SoAVector(std::initializer_list<value_type> list) {
+    Reserve(list.size());
+    for (const auto& row : list) Push_back(row);
+  }
+
+  reference operator[](size_type pos) { return row(pos, indices{}); }
+  const_reference operator[](size_type pos) const {
+    return row(pos, indices{});
+  }
+
+  reference At(size_type pos) {
+    if (pos >= Size()) throw std::out_of_range("Index is out of range!");
+    return operator[](pos);
+  }
+  const_reference At(size_type pos) const {
+    if (pos >= Size()) throw std::out_of_range("Index is out of range!");
+    return operator[](pos);
+  }
+
+  reference Front() { return operator[](0ull); }
+  const_reference Front() const { return operator[](0ull); }
+  reference Back() { return operator[](Size() - 1ull); }
+  const_reference Back() const { return operator[](Size() - 1ull); }
+
+  // field I of row pos
+  template <std::size_t I>
+  auto& Get(size_type pos) {
+    return std::get<I>(columns_)[pos];
+  }
+  template <std::size_t I>
+  const auto& Get(size_type pos) const {
+    return std::get<I>(columns_)[pos];
+  }
+
+  // Size() contiguous values of field I
+  template <std::size_t I>
+  auto* Data() noexcept {
+    return std::get<I>(columns_).Data();
+  }
+  template <std::size_t I>
+  const auto* Data() const noexcept {
+    return std::get<I>(columns_).Data();
+  }
+  template <std::size_t I>
+  const column_type<I>& Column() const noexcept {
+    return std::get<I>(columns_);
+  }
+
+  iterator begin() noexcept { return iterator(this, 0ull); }
+  const_iterator begin() const noexcept { return cbegin(); }
+  const_iterator cbegin() const noexcept { return const_iterator(this, 0ull); }
+  iterator end() noexcept { return iterator(this, Size()); }
+  const_iterator end() const noexcept { return cend(); }
+  const_iterator cend() const noexcept { return const_iterator(this, Size()); }
+
+  size_type Size() const noexcept { return std::get<0>(columns_).Size(); }
+  bool Empty() const noexcept { return !Size(); }
+  // rows which fit into every column without reallocation
+  size_type Capacity() const noexcept {
+    return std::apply(
+        [](const auto&... column) {
+          return std::min({column.Capacity()...});
+        },
+        columns_);
+  }
+
+  void Reserve(size_type new_capacity) {
+    std::apply(
+        [new_capacity](auto&... column) {
+          (column.Reserve(new_capacity), ...);
+        },
+        columns_);
+  }
+  void Shrink_to_fit() {
+    std::apply([](auto&... column) { (column.Shrink_to_fit(), ...); },
+               columns_);
+  }
+  void Clear() {
+    std::apply([](auto&... column) { (column.Clear(), ...); }, columns_);
+  }
+
+  void Push_back(const value_type& row) { pushBack(row, indices{}); }
+  void Push_back(value_type&& row) { pushBack(std::move(row), indices{}); }
+
+  // one argument per field
+  template <typename... Args>
+  void Emplace_back(Args&&... args) {
+    static_assert(sizeof...(Args) == sizeof...(Fields),
+                  "One argument per field is expected!");
+    emplaceBack(indices{}, std::forward<Args>(args)...);
+  }
+
+  void Pop_back() {
+    assert(Size() && "Pop_back from empty vector!");
+    std::apply([](auto&... column) { (column.Pop_back(), ...); }, columns_);
+  }
+
+  // new rows are value-initialized
+  void Resize(size_type count) {
+    std::apply([count](auto&... column) { (column.Resize(count), ...); },
+               columns_);
+  }
+
+  void Swap(SoAVector& other) { columns_.swap(other.columns_); }
+
+ private:
+  template <std::size_t... I>
+  reference row(size_type pos, std::index_sequence<I...>) {
+    return reference(std::get<I>(columns_)[pos]...);
+  }
+  template <std::size_t... I>
+  const_reference row(size_type pos, std::index_sequence<I...>) const {
+    return const_reference(std::get<I>(columns_)[pos]...);
+  }
+
+  template <typename Row, std::size_t... I>
+  void pushBack(Row&& row, std::index_sequence<I...> sequence) {
+    emplaceBack(sequence, std::get<I>(std::forward<Row>(row))...);
+  }
+  // when a column fails to grow, the ones before it drop their new element
+  template <std::size_t... I, typename... Args>
+  void emplaceBack(std::index_sequence<I...>, Args&&... args) {
+    const size_type size = Size();
+    try {
+      (std::get<I>(columns_).Emplace_back(std::forward<Args>(args)), ...);
+    } catch (...) {
+      ((std::get<I>(columns_).Size() > size ? std::get<I>(columns_).Pop_back()
+                                            : void()),
+       ...);
+      throw;
+    }
+  }
+};
+
+template <typename... Fields>
+bool operator==(const SoAVector<Fields...>& left,
+                const SoAVector<Fields...>& right) {
+  if (left.Size() != right.Size()) return false;
+
+  for (std::size_t i = 0ull; i < left.Size(); ++i)
+    if (left[i] != right[i]) return false;
+
+  return true;
+}
+
+template <typename... Fields>
+bool operator!=(const SoAVector<Fields...>& left,
+                const SoAVector<Fields...>& right) {
+  return !(left == right);
+}
+
+}  // namespace s21
+
+#endif  //  _S21_SOA_VECTOR_H_
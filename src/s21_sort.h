@@ -0,0 +1,518 @@
+#ifndef _S21_SORT_H_
+#define _S21_SORT_H_
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "s21_utility.h"
+#include "s21_vector.h"
+
+namespace s21 {
+
+namespace SortDetail {
+
+constexpr std::ptrdiff_t kInsertionSortThreshold = 24;
+constexpr std::ptrdiff_t kNintherThreshold = 128;
+constexpr std::ptrdiff_t kPartialInsertionSortLimit = 8;
+constexpr std::ptrdiff_t kMergeSortThreshold = 32;
+
+// compares the projections of the elements
+template <typename Compare, typename Projection>
+class ProjectedCompare {
+ private:
+  Compare compare_;
+  Projection projection_;
+
+ public:
+  ProjectedCompare(Compare compare, Projection projection)
+      : compare_{std::move(compare)}, projection_{std::move(projection)} {}
+
+  template <typename Left, typename Right>
+  bool operator()(Left&& left, Right&& right) {
+    return std::invoke(compare_,
+                       std::invoke(projection_, std::forward<Left>(left)),
+                       std::invoke(projection_, std::forward<Right>(right)));
+  }
+};
+
+template <typename Iterator>
+using value_type = typename std::iterator_traits<Iterator>::value_type;
+
+template <typename Iterator, typename Compare>
+void insertionSort(Iterator begin, Iterator end, Compare& compare) {
+  if (begin == end) return;
+
+  for (Iterator current = begin + 1; current != end; ++current) {
+    Iterator sift = current;
+    Iterator previous = current - 1;
+    if (!compare(*sift, *previous)) continue;
+
+    value_type<Iterator> temporary = std::move(*sift);
+    do {
+      *sift-- = std::move(*previous);
+    } while (sift != begin && compare(temporary, *--previous));
+    *sift = std::move(temporary);
+  }
+}
+
+// an element not greater than any of [begin, end) is right before begin
+template <typename Iterator, typename Compare>
+void unguardedInsertionSort(Iterator begin, Iterator end, Compare& compare) {
+  if (begin == end) return;
+
+  for (Iterator current = begin + 1; current != end; ++current) {
+    Iterator sift = current;
+    Iterator previous = current - 1;
+    if (!compare(*sift, *previous)) continue;
+
+    value_type<Iterator> temporary = std::move(*sift);
+    do {
+      *sift-- = std::move(*previous);
+    } while (compare(temporary, *--previous));
+    *sift = std::move(temporary);
+  }
+}
+
+// gives up when too many elements are out of place
+template <typename Iterator, typename Compare>
+bool partialInsertionSort(Iterator begin, Iterator end, Compare& compare) {
+  if (begin == end) return true;
+
+  std::ptrdiff_t moves = 0;
+  for (Iterator current = begin + 1; current != end; ++current) {
+    Iterator sift = current;
+    Iterator previous = current - 1;
+    if (!compare(*sift, *previous)) continue;
+
+    value_type<Iterator> temporary = std::move(*sift);
+    do {
+      *sift-- = std::move(*previous);
+    } while (sift != begin && compare(temporary, *--previous));
+    *sift = std::move(temporary);
+
+    moves += current - sift;
+    if (moves > kPartialInsertionSortLimit) return false;
+  }
+  return true;
+}
+
+template <typename Iterator, typename Compare>
+void siftDown(Iterator begin, std::ptrdiff_t size, std::ptrdiff_t root,
+              Compare& compare) {
+  value_type<Iterator> temporary = std::move(begin[root]);
+  while (true) {
+    std::ptrdiff_t child = 2 * root + 1;
+    if (child >= size) break;
+    if (child + 1 < size && compare(begin[child], begin[child + 1])) ++child;
+    if (!compare(temporary, begin[child])) break;
+
+    begin[root] = std::move(begin[child]);
+    root = child;
+  }
+  begin[root] = std::move(temporary);
+}
+
+template <typename Iterator, typename Compare>
+void heapSort(Iterator begin, Iterator end, Compare& compare) {
+  const std::ptrdiff_t size = end - begin;
+  for (std::ptrdiff_t root = size / 2 - 1; root >= 0; --root)
+    siftDown(begin, size, root, compare);
+  for (std::ptrdiff_t last = size - 1; last > 0; --last) {
+    std::iter_swap(begin, begin + last);
+    siftDown(begin, last, 0, compare);
+  }
+}
+
+template <typename Iterator, typename Compare>
+void sort2(Iterator left, Iterator right, Compare& compare) {
+  if (compare(*right, *left)) std::iter_swap(left, right);
+}
+
+template <typename Iterator, typename Compare>
+void sort3(Iterator first, Iterator second, Iterator third, Compare& compare) {
+  sort2(first, second, compare);
+  sort2(second, third, compare);
+  sort2(first, second, compare);
+}
+
+// the elements less than the pivot *begin go to its left, the others to the
+// right; also tells whether nothing had to be swapped
+template <typename Iterator, typename Compare>
+std::pair<Iterator, bool> partitionRight(Iterator begin, Iterator end,
+                                         Compare& compare) {
+  value_type<Iterator> pivot(std::move(*begin));
+  Iterator first = begin;
+  Iterator last = end;
+
+  // the median of three guarantees an element not less than the pivot
+  while (compare(*++first, pivot)) {
+  }
+  if (first - 1 == begin) {
+    while (first < last && !compare(*--last, pivot)) {
+    }
+  } else {
+    while (!compare(*--last, pivot)) {
+    }
+  }
+
+  const bool already_partitioned = first >= last;
+  while (first < last) {
+    std::iter_swap(first, last);
+    while (compare(*++first, pivot)) {
+    }
+    while (!compare(*--last, pivot)) {
+    }
+  }
+
+  Iterator pivot_position = first - 1;
+  *begin = std::move(*pivot_position);
+  *pivot_position = std::move(pivot);
+  return {pivot_position, already_partitioned};
+}
+
+// the elements equal to the pivot *begin go to its left: used when the
+// pivot equals the element before the range, so all of them are in place
+template <typename Iterator, typename Compare>
+Iterator partitionLeft(Iterator begin, Iterator end, Compare& compare) {
+  value_type<Iterator> pivot(std::move(*begin));
+  Iterator first = begin;
+  Iterator last = end;
+
+  while (compare(pivot, *--last)) {
+  }
+  if (last + 1 == end) {
+    while (first < last && !compare(pivot, *++first)) {
+    }
+  } else {
+    while (!compare(pivot, *++first)) {
+    }
+  }
+
+  while (first < last) {
+    std::iter_swap(first, last);
+    while (compare(pivot, *--last)) {
+    }
+    while (!compare(pivot, *++first)) {
+    }
+  }
+
+  Iterator pivot_position = last;
+  *begin = std::move(*pivot_position);
+  *pivot_position = std::move(pivot);
+  return pivot_position;
+}
+
+// breaks patterns which give bad pivots by swapping some elements
+template <typename Iterator>
+void shuffleSides(Iterator begin, Iterator pivot_position, Iterator end) {
+  const std::ptrdiff_t left_size = pivot_position - begin;
+  const std::ptrdiff_t right_size = end - (pivot_position + 1);
+
+  if (left_size >= kInsertionSortThreshold) {
+    std::iter_swap(begin, begin + left_size / 4);
+    std::iter_swap(pivot_position - 1, pivot_position - left_size / 4);
+    if (left_size > kNintherThreshold) {
+      std::iter_swap(begin + 1, begin + (left_size / 4 + 1));
+      std::iter_swap(begin + 2, begin + (left_size / 4 + 2));
+      std::iter_swap(pivot_position - 2, pivot_position - (left_size / 4 + 1));
+      std::iter_swap(pivot_position - 3, pivot_position - (left_size / 4 + 2));
+    }
+  }
+  if (right_size >= kInsertionSortThreshold) {
+    std::iter_swap(pivot_position + 1, pivot_position + (1 + right_size / 4));
+    std::iter_swap(end - 1, end - right_size / 4);
+    if (right_size > kNintherThreshold) {
+      std::iter_swap(pivot_position + 2, pivot_position + (2 + right_size / 4));
+      std::iter_swap(pivot_position + 3, pivot_position + (3 + right_size / 4));
+      std::iter_swap(end - 2, end - (1 + right_size / 4));
+      std::iter_swap(end - 3, end - (2 + right_size / 4));
+    }
+  }
+}
+
+// pattern-defeating quicksort: median of three (of nine for big ranges)
+// pivots, equal elements put aside at once, nearly sorted ranges finished by
+// insertion sort, and heap sort after too many bad partitions
+template <typename Iterator, typename Compare>
+void pdqsort(Iterator begin, Iterator end, Compare& compare, int bad_allowed,
+             bool leftmost) {
+  while (true) {
+    const std::ptrdiff_t size = end - begin;
+    if (size < kInsertionSortThreshold) {
+      if (leftmost)
+        insertionSort(begin, end, compare);
+      else
+        unguardedInsertionSort(begin, end, compare);
+      return;
+    }
+
+    const std::ptrdiff_t half = size / 2;
+    if (size > kNintherThreshold) {
+      sort3(begin, begin + half, end - 1, compare);
+      sort3(begin + 1, begin + (half - 1), end - 2, compare);
+      sort3(begin + 2, begin + (half + 1), end - 3, compare);
+      sort3(begin + (half - 1), begin + half, begin + (half + 1), compare);
+      std::iter_swap(begin, begin + half);
+    } else {
+      sort3(begin + half, begin, end - 1, compare);
+    }
+
+    if (!leftmost && !compare(*(begin - 1), *begin)) {
+      begin = partitionLeft(begin, end, compare) + 1;
+      continue;
+    }
+
+    const auto [pivot_position, already_partitioned] =
+        partitionRight(begin, end, compare);
+    const std::ptrdiff_t left_size = pivot_position - begin;
+    const std::ptrdiff_t right_size = end - (pivot_position + 1);
+
+    if (left_size < size / 8 || right_size < size / 8) {
+      if (--bad_allowed == 0) {
+        heapSort(begin, end, compare);
+        return;
+      }
+      shuffleSides(begin, pivot_position, end);
+    } else if (already_partitioned &&
+               partialInsertionSort(begin, pivot_position, compare) &&
+               partialInsertionSort(pivot_position + 1, end, compare)) {
+      return;
+    }
+
+    pdqsort(begin, pivot_position, compare, bad_allowed, leftmost);
+    begin = pivot_position + 1;
+    leftmost = false;
+  }
+}
+
+// uninitialized memory for the merges, the elements constructed in it are
+// destroyed with it
+template <typename Type>
+class MergeBuffer {
+ private:
+  std::allocator<Type> allocator_;
+  Type* data_;
+  std::size_t capacity_;
+  std::size_t size_;
+
+ public:
+  explicit MergeBuffer(std::size_t capacity)
+      : data_{capacity ? allocator_.allocate(capacity) : nullptr},
+        capacity_{capacity},
+        size_{0ull} {}
+  MergeBuffer(const MergeBuffer&) = delete;
+  MergeBuffer& operator=(const MergeBuffer&) = delete;
+  ~MergeBuffer() {
+    Clear();
+    if (data_) allocator_.deallocate(data_, capacity_);
+  }
+
+  template <typename Iterator>
+  void Take(Iterator begin, Iterator end) {
+    for (; begin != end; ++begin, ++size_)
+      ::new (static_cast<void*>(data_ + size_)) Type(std::move(*begin));
+  }
+  void Clear() noexcept {
+    for (; size_; --size_) data_[size_ - 1ull].~Type();
+  }
+
+  Type* begin() noexcept { return data_; }
+  Type* end() noexcept { return data_ + size_; }
+};
+
+template <typename Iterator, typename Compare>
+void mergeSort(Iterator begin, Iterator end, Compare& compare,
+               MergeBuffer<value_type<Iterator>>& buffer) {
+  const std::ptrdiff_t size = end - begin;
+  if (size <= kMergeSortThreshold) {
+    insertionSort(begin, end, compare);
+    return;
+  }
+
+  const Iterator middle = begin + size / 2;
+  mergeSort(begin, middle, compare, buffer);
+  mergeSort(middle, end, compare, buffer);
+  if (!compare(*middle, *(middle - 1))) return;  // already in order
+
+  // the left half waits in the buffer, equal elements are taken from it
+  // first to stay stable
+  buffer.Take(begin, middle);
+  auto left = buffer.begin();
+  Iterator right = middle;
+  Iterator out = begin;
+  while (left != buffer.end() && right != end) {
+    if (compare(*right, *left))
+      *out++ = std::move(*right++);
+    else
+      *out++ = std::move(*left++);
+  }
+  while (left != buffer.end()) *out++ = std::move(*left++);
+  buffer.Clear();
+}
+
+// radix sort orders the keys as unsigned integers of the same size
+template <typename Key>
+auto radixKey(Key key) noexcept {
+  if constexpr (std::is_same_v<Key, bool>) {
+    return static_cast<std::uint8_t>(key);
+  } else if constexpr (std::is_floating_point_v<Key>) {
+    // negative numbers are inverted wholly, positive ones get the sign bit
+    using Bits =
+        std::conditional_t<sizeof(Key) == 4ull, std::uint32_t, std::uint64_t>;
+    static_assert(sizeof(Key) == sizeof(Bits), "float or double only!");
+    Bits bits;
+    std::memcpy(&bits, &key, sizeof(bits));
+    constexpr Bits sign = Bits(1) << (sizeof(Bits) * 8ull - 1ull);
+    return bits & sign ? Bits(~bits) : Bits(bits | sign);
+  } else if constexpr (std::is_enum_v<Key>) {
+    return radixKey(static_cast<std::underlying_type_t<Key>>(key));
+  } else {
+    static_assert(std::is_integral_v<Key>, "Radix sort needs numeric keys!");
+    using Bits = std::make_unsigned_t<Key>;
+    constexpr Bits sign =
+        std::is_signed_v<Key> ? Bits(Bits(1) << (sizeof(Bits) * 8ull - 1ull))
+                              : Bits(0);
+    return Bits(static_cast<Bits>(key) ^ sign);
+  }
+}
+
+}  // namespace SortDetail
+
+// Sort, Stable_sort and Radix_sort take a range of random access iterators
+// (pointers to Vector::Data() are the fastest) or a container with Data()
+// and Size(). projection gives what is compared: a member pointer or any
+// callable, the element itself by default
+
+// unstable, O(n log n) in the worst case
+template <typename Iterator, typename Compare = std::less<>,
+          typename Projection = Utility::Identity>
+void Sort(Iterator first, Iterator last, Compare compare = Compare(),
+          Projection projection = Projection()) {
+  const std::ptrdiff_t size = last - first;
+  if (size < 2) return;
+
+  int bad_allowed = 0;
+  for (std::ptrdiff_t rest = size; rest > 1; rest >>= 1) ++bad_allowed;
+
+  SortDetail::ProjectedCompare<Compare, Projection> projected(
+      std::move(compare), std::move(projection));
+  SortDetail::pdqsort(first, last, projected, bad_allowed, true);
+}
+
+// equal elements keep their order; takes memory for half of the elements
+template <typename Iterator, typename Compare = std::less<>,
+          typename Projection = Utility::Identity>
+void Stable_sort(Iterator first, Iterator last, Compare compare = Compare(),
+                 Projection projection = Projection()) {
+  const std::ptrdiff_t size = last - first;
+  if (size < 2) return;
+
+  SortDetail::ProjectedCompare<Compare, Projection> projected(
+      std::move(compare), std::move(projection));
+  SortDetail::MergeBuffer<SortDetail::value_type<Iterator>> buffer(
+      static_cast<std::size_t>(size / 2));
+  SortDetail::mergeSort(first, last, projected, buffer);
+}
+
+// stable least significant digit first radix sort by an integer, floating
+// point or enum key: a pass per byte of the key, the passes where all the
+// keys have the same byte are skipped. Takes memory for all the elements
+template <typename Iterator, typename Projection = Utility::Identity>
+void Radix_sort(Iterator first, Iterator last,
+                Projection projection = Projection()) {
+  using Key = std::decay_t<std::invoke_result_t<
+      Projection&, typename std::iterator_traits<Iterator>::reference>>;
+  using Bits = decltype(SortDetail::radixKey(std::declval<Key>()));
+  constexpr std::size_t kDigits = sizeof(Bits);
+  constexpr std::size_t kRadix = 256ull;
+
+  const std::size_t size = static_cast<std::size_t>(last - first);
+  if (size < 2ull) return;
+
+  auto key = [&projection](const auto& element) {
+    return SortDetail::radixKey(
+        static_cast<Key>(std::invoke(projection, element)));
+  };
+
+  // the counts for all the digits in one pass over the data
+  Vector<std::size_t> counts(kDigits * kRadix, 0ull);
+  for (Iterator it = first; it != last; ++it) {
+    const Bits bits = key(*it);
+    for (std::size_t digit = 0ull; digit < kDigits; ++digit)
+      ++counts[digit * kRadix + ((bits >> (digit * 8ull)) & 0xffu)];
+  }
+
+  Vector<SortDetail::value_type<Iterator>> buffer;
+  buffer.Reserve(size);
+  for (Iterator it = first; it != last; ++it)
+    buffer.Emplace_back(std::move(*it));
+
+  bool in_buffer = true;
+  for (std::size_t digit = 0ull; digit < kDigits; ++digit) {
+    std::size_t* count = &counts[digit * kRadix];
+    if (count[(key(in_buffer ? buffer[0] : *first) >> (digit * 8ull)) &
+              0xffu] == size)
+      continue;  // the same byte everywhere
+
+    std::size_t offset = 0ull;
+    for (std::size_t i = 0ull; i < kRadix; ++i) {
+      const std::size_t bucket = count[i];
+      count[i] = offset;
+      offset += bucket;
+    }
+
+    for (std::size_t i = 0ull; i < size; ++i) {
+      if (in_buffer) {
+        const std::size_t byte = (key(buffer[i]) >> (digit * 8ull)) & 0xffu;
+        first[static_cast<std::ptrdiff_t>(count[byte]++)] =
+            std::move(buffer[i]);
+      } else {
+        auto& element = first[static_cast<std::ptrdiff_t>(i)];
+        const std::size_t byte = (key(element) >> (digit * 8ull)) & 0xffu;
+        buffer[count[byte]++] = std::move(element);
+      }
+    }
+    in_buffer = !in_buffer;
+  }
+
+  if (in_buffer)
+    for (std::size_t i = 0ull; i < size; ++i)
+      first[static_cast<std::ptrdiff_t>(i)] = std::move(buffer[i]);
+}
+
+// the same over a container with Data() and Size(): Vector, Array ...
+template <typename Container, typename Compare = std::less<>,
+          typename Projection = Utility::Identity,
+          typename = decltype(std::declval<Container&>().Data())>
+void Sort(Container& container, Compare compare = Compare(),
+          Projection projection = Projection()) {
+  Sort(container.Data(), container.Data() + container.Size(),
+       std::move(compare), std::move(projection));
+}
+
+template <typename Container, typename Compare = std::less<>,
+          typename Projection = Utility::Identity,
+          typename = decltype(std::declval<Container&>().Data())>
+void Stable_sort(Container& container, Compare compare = Compare(),
+                 Projection projection = Projection()) {
+  Stable_sort(container.Data(), container.Data() + container.Size(),
+              std::move(compare), std::move(projection));
+}
+
+template <typename Container, typename Projection = Utility::Identity,
+          typename = decltype(std::declval<Container&>().Data())>
+void Radix_sort(Container& container, Projection projection = Projection()) {
+  Radix_sort(container.Data(), container.Data() + container.Size(),
+             std::move(projection));
+}
+
+}  // namespace s21
+
+#endif  //  _S21_SORT_H_
@@ -0,0 +1,170 @@
+#ifndef _S21_SORTED_INDEX_H_
+#define _S21_SORTED_INDEX_H_
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <utility>
+
+#include "s21_aligned_allocator.h"
+#include "s21_utility.h"
+#include "s21_vector.h"
+
+namespace s21 {
+
+// Read-only copy of sorted keys for searching: the keys are laid out in
+// Eytzinger (breadth-first) order, node k having children 2k and 2k + 1, so
+// the top levels of every search share a few cache lines and a search goes
+// down without branches. The keys are aligned to a cache line, which makes
+// the 16 (for 4-byte keys) descendants of a node four levels down one line,
+// fetched ahead while the levels between are compared. Searches answer
+// with ranks: positions in the sorted keys the index was built from. Key
+// should be default constructible and copyable
+template <typename Key, typename Comparator = Utility::Less<Key>>
+class SortedIndex {
+ public:
+  using key_type = Key;
+  using size_type = std::size_t;
+  using comparator = Comparator;
+
+  static constexpr size_type npos = static_cast<size_type>(-1);
+
+ private:
+  static constexpr size_type kLine = 64ull;
+  // the keys in a cache line, the nodes four levels down for small keys
+  static constexpr size_type kPrefetchStride =
+      sizeof(Key) < kLine ? kLine / sizeof(Key) : 1ull;
+  // searches a batch interleaves to keep that many loads in flight
+  static constexpr size_type kBatch = 16ull;
+
+  // keys_[0] and ranks_[0] are not used
+  AlignedVector<Key, kLine> keys_;
+  Vector<size_type> ranks_;
+  size_type size_ = 0ull;
+  // levels every search passes: the complete ones of the tree
+  size_type levels_ = 0ull;
+  comparator comparator_;
+
+ public:
+  SortedIndex() = default;
+  // sorted should be sorted with comparator
+  SortedIndex(const Key* sorted, size_type count,
+              const comparator& compare = comparator())
+      : comparator_{compare} {
+    Assign(sorted, count);
+  }
+  template <typename Container,
+            typename = decltype(std::declval<const Container&>().Data())>
+  explicit SortedIndex(const Container& sorted,
+                       const comparator& compare = comparator())
+      : SortedIndex(sorted.Data(), sorted.Size(), compare) {}
+
+  void Assign(const Key* sorted, size_type count) {
+    assert(std::is_sorted(sorted, sorted + count, comparator_) &&
+           "Keys are not sorted!");
+    keys_.Resize(count + 1ull);
+    ranks_.Resize_default_init(count + 1ull);
+    size_ = count;
+    levels_ = 0ull;
+    while ((2ull << levels_) - 1ull <= count) ++levels_;
+    fill(sorted, 0ull, 1ull);
+  }
+
+  size_type Size() const noexcept { return size_; }
+  bool Empty() const noexcept { return !size_; }
+
+  // the rank of the first key not less than key, Size() when there is none
+  size_type Lower_bound(const Key& key) const {
+    return rank(node(search(key)));
+  }
+
+  bool Contains(const Key& key) const {
+    const size_type k = node(search(key));
+    return k && !comparator_(key, keys_[k]);
+  }
+
+  // the rank of key or npos
+  size_type Find(const Key& key) const {
+    const size_type k = node(search(key));
+    return k && !comparator_(key, keys_[k]) ? ranks_[k] : npos;
+  }
+
+  // out[i] = Lower_bound(keys[i]); kBatch searches go down the tree side by
+  // side, so their cache misses overlap instead of following one another
+  void Lower_bound(const Key* keys, size_type count, size_type* out) const {
+    size_type i = 0ull;
+    for (; i + kBatch <= count; i += kBatch) {
+      size_type nodes[kBatch];
+      std::fill(nodes, nodes + kBatch, 1ull);
+      for (size_type level = 0ull; level < levels_; ++level)
+        for (size_type j = 0ull; j < kBatch; ++j)
+          nodes[j] =
+              2ull * nodes[j] + comparator_(keys_[nodes[j]], keys[i + j]);
+      for (size_type j = 0ull; j < kBatch; ++j)
+        out[i + j] = rank(node(last(nodes[j], keys[i + j])));
+    }
+    for (; i < count; ++i) out[i] = Lower_bound(keys[i]);
+  }
+
+  template <typename Container,
+            typename = decltype(std::declval<const Container&>().Data())>
+  Vector<size_type> Lower_bound(const Container& keys) const {
+    Vector<size_type> result;
+    result.Resize_default_init(keys.Size());
+    Lower_bound(keys.Data(), keys.Size(), result.Data());
+    return result;
+  }
+
+ private:
+  // places sorted[rank...] into the subtree of node k in order, gives the
+  // rank after the subtree
+  size_type fill(const Key* sorted, size_type rank, size_type k) {
+    if (k <= size_) {
+      rank = fill(sorted, rank, 2ull * k);
+      keys_[k] = sorted[rank];
+      ranks_[k] = rank++;
+      rank = fill(sorted, rank, 2ull * k + 1ull);
+    }
+    return rank;
+  }
+
+  // the leaf position the search for key ends at: left turns are the zero
+  // bits of its path, right ones (key is greater) the one bits
+  size_type search(const Key& key) const {
+    size_type k = 1ull;
+    for (size_type level = 0ull; level < levels_; ++level) {
+      prefetch(k * kPrefetchStride);
+      k = 2ull * k + comparator_(keys_[k], key);
+    }
+    return last(k, key);
+  }
+
+  // the incomplete last level: only some of the searches get there
+  size_type last(size_type k, const Key& key) const {
+    return k <= size_ ? 2ull * k + comparator_(keys_[k], key) : k;
+  }
+
+  // the node of the last left turn, the lower bound; 0 after right turns
+  // only, when every key is less
+  static size_type node(size_type k) noexcept {
+    return k >> (__builtin_ctzll(~k) + 1);
+  }
+
+  size_type rank(size_type k) const noexcept {
+    return k ? ranks_[k] : size_;
+  }
+
+  // k may be past the last node: a prefetch never faults, and checking
+  // would cost a branch per level
+  void prefetch(size_type k) const noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(keys_.Data() + k);
+#else
+    (void)k;
+#endif
+  }
+};
+
+}  // namespace s21
+
+#endif  //  _S21_SORTED_INDEX_H_
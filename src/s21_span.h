@@ -0,0 +1,215 @@
+#ifndef _S21_SPAN_H_
+#define _S21_SPAN_H_
+
+#include <cassert>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_vector.h"
+
+namespace s21 {
+
+namespace SpanDetail {
+
+// the size of a span: nothing to keep when it is known at compile time
+template <std::size_t Extent>
+class SizeHolder {
+ public:
+  constexpr explicit SizeHolder(std::size_t size) noexcept {
+    assert(size == Extent && "Size differs from the extent!");
+    (void)size;
+  }
+  constexpr std::size_t size() const noexcept { return Extent; }
+};
+
+template <>
+class SizeHolder<kDynamicExtent> {
+ public:
+  constexpr explicit SizeHolder(std::size_t size) noexcept : size_{size} {}
+  constexpr std::size_t size() const noexcept { return size_; }
+
+ private:
+  std::size_t size_;
+};
+
+// Container gives contiguous elements which a Span<Type> may look at
+template <typename Container, typename Type, typename = void>
+struct IsContainerOf : std::false_type {};
+
+template <typename Container, typename Type>
+struct IsContainerOf<
+    Container, Type,
+    std::void_t<decltype(std::declval<Container&>().Size()),
+                decltype(std::declval<Container&>().Data())>>
+    : std::is_convertible<std::remove_pointer_t<decltype(
+                              std::declval<Container&>().Data())> (*)[],
+                          Type (*)[]> {};
+
+}  // namespace SpanDetail
+
+// Non-owning view of Size() contiguous elements: a part of Vector, Array,
+// SmallVector, a C array or any buffer like a mapped file. Copying a span
+// copies a pointer and a size, so it is passed by value; the elements
+// should outlive it. With Extent given the size is a compile-time constant
+// and takes no space. Span<const Type> is a read-only view, Span<Type>
+// converts to it
+template <typename Type, std::size_t Extent>
+class Span : private SpanDetail::SizeHolder<Extent> {
+  using size_holder = SpanDetail::SizeHolder<Extent>;
+
+ public:
+  using element_type = Type;
+  using value_type = std::remove_cv_t<Type>;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using pointer = Type*;
+  using const_pointer = const Type*;
+  using reference = Type&;
+  using const_reference = const Type&;
+
+  using iterator = VectorIterator<Span, pointer, reference>;
+  using reverse_iterator = VectorReverseIterator<Span, pointer, reference>;
+
+  static constexpr size_type kExtent = Extent;
+
+  template <typename OtherType, std::size_t OtherExtent>
+  friend class Span;
+
+ private:
+  pointer data_;
+
+ public:
+  template <std::size_t E = Extent,
+            typename = std::enable_if_t<E == 0ull || E == kDynamicExtent>>
+  constexpr Span() noexcept : size_holder(0ull), data_{nullptr} {}
+  constexpr Span(pointer data, size_type count) noexcept
+      : size_holder(count), data_{data} {}
+  constexpr Span(pointer first, pointer last) noexcept
+      : size_holder(static_cast<size_type>(last - first)), data_{first} {}
+  template <std::size_t N, typename = std::enable_if_t<
+                               Extent == kDynamicExtent || Extent == N>>
+  constexpr Span(element_type (&array)[N]) noexcept
+      : size_holder(N), data_{array} {}
+  // Vector, Array, SmallVector ... kept as lvalues, Data() and Size() of
+  // a const one give only a span of const elements
+  template <typename Container,
+            typename = std::enable_if_t<
+                !std::is_base_of_v<Span, std::remove_cv_t<Container>> &&
+                SpanDetail::IsContainerOf<Container, Type>::value>>
+  constexpr Span(Container& container)
+      : size_holder(container.Size()), data_{container.Data()} {}
+  // Span<Type> to Span<const Type>, a fixed extent to the dynamic one
+  template <typename OtherType, std::size_t OtherExtent,
+            typename = std::enable_if_t<
+                std::is_convertible_v<OtherType (*)[], Type (*)[]> &&
+                (Extent == kDynamicExtent || Extent == OtherExtent)>>
+  constexpr Span(const Span<OtherType, OtherExtent>& other) noexcept
+      : size_holder(other.Size()), data_{other.data_} {}
+
+  constexpr size_type Size() const noexcept { return size_holder::size(); }
+  constexpr size_type Size_bytes() const noexcept {
+    return Size() * sizeof(element_type);
+  }
+  constexpr bool Empty() const noexcept { return !Size(); }
+
+  constexpr pointer Data() const noexcept { return data_; }
+  constexpr reference operator[](size_type pos) const noexcept {
+    assert(pos < Size() && "Index is out of range!");
+    return data_[pos];
+  }
+  constexpr reference At(size_type pos) const {
+    if (pos >= Size()) throw std::out_of_range("Index is out of range!");
+    return data_[pos];
+  }
+  constexpr reference Front() const noexcept { return data_[0ull]; }
+  constexpr reference Back() const noexcept { return data_[Size() - 1ull]; }
+
+  iterator begin() const noexcept { return iterator(data_); }
+  iterator end() const noexcept { return iterator(data_ + Size()); }
+  reverse_iterator rbegin() const noexcept {
+    return reverse_iterator(data_ + Size() - 1ull);
+  }
+  reverse_iterator rend() const noexcept {
+    return reverse_iterator(data_ - 1ull);
+  }
+
+  // the first, the last Count elements and Count from Offset on; Count is
+  // the rest when it is not given
+  template <size_type Count>
+  constexpr Span<element_type, Count> First() const noexcept {
+    static_assert(Extent == kDynamicExtent || Count <= Extent,
+                  "Count is greater than the extent!");
+    assert(Count <= Size() && "Count is greater than the size!");
+    return Span<element_type, Count>(data_, Count);
+  }
+  constexpr Span<element_type> First(size_type count) const noexcept {
+    assert(count <= Size() && "Count is greater than the size!");
+    return Span<element_type>(data_, count);
+  }
+  template <size_type Count>
+  constexpr Span<element_type, Count> Last() const noexcept {
+    static_assert(Extent == kDynamicExtent || Count <= Extent,
+                  "Count is greater than the extent!");
+    assert(Count <= Size() && "Count is greater than the size!");
+    return Span<element_type, Count>(data_ + (Size() - Count), Count);
+  }
+  constexpr Span<element_type> Last(size_type count) const noexcept {
+    assert(count <= Size() && "Count is greater than the size!");
+    return Span<element_type>(data_ + (Size() - count), count);
+  }
+  template <size_type Offset, size_type Count = kDynamicExtent>
+  constexpr auto Subspan() const noexcept {
+    static_assert(Extent == kDynamicExtent ||
+                      (Offset <= Extent &&
+                       (Count == kDynamicExtent || Count <= Extent - Offset)),
+                  "Subspan is out of the extent!");
+    constexpr size_type extent =
+        Count != kDynamicExtent
+            ? Count
+            : (Extent != kDynamicExtent ? Extent - Offset : kDynamicExtent);
+    assert(Offset <= Size() && "Offset is greater than the size!");
+    return Span<element_type, extent>(
+        data_ + Offset, Count != kDynamicExtent ? Count : Size() - Offset);
+  }
+  constexpr Span<element_type> Subspan(
+      size_type offset, size_type count = kDynamicExtent) const noexcept {
+    assert(offset <= Size() && "Offset is greater than the size!");
+    if (count == kDynamicExtent) count = Size() - offset;
+    assert(count <= Size() - offset && "Subspan is out of the span!");
+    return Span<element_type>(data_ + offset, count);
+  }
+};
+
+template <typename Type, std::size_t N>
+Span(Type (&)[N]) -> Span<Type, N>;
+
+template <typename Container>
+Span(Container&) -> Span<std::remove_pointer_t<
+    decltype(std::declval<Container&>().Data())>>;
+
+template <typename Type>
+Span(Type*, std::size_t) -> Span<Type>;
+
+// elements compared one by one, as Vector does
+template <typename Left, std::size_t LeftExtent, typename Right,
+          std::size_t RightExtent>
+bool operator==(Span<Left, LeftExtent> left, Span<Right, RightExtent> right) {
+  if (left.Size() != right.Size()) return false;
+
+  for (std::size_t i = 0ull; i < left.Size(); ++i)
+    if (left[i] != right[i]) return false;
+
+  return true;
+}
+
+template <typename Left, std::size_t LeftExtent, typename Right,
+          std::size_t RightExtent>
+bool operator!=(Span<Left, LeftExtent> left, Span<Right, RightExtent> right) {
+  return !(left == right);
+}
+
+}  // namespace s21
+
+#endif  //  _S21_SPAN_H_
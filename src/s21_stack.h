@@ -1,5 +1,9 @@
 #ifndef _S21_STACK_H_
 #define _S21_STACK_H_
+
+#include <memory>
+#include <type_traits>
+
 #include "s21_list.h"
 
 namespace s21 {
@@ -26,18 +30,30 @@ class Stack {
 
   template <class InputIt>
   Stack(InputIt first, InputIt last) : stack_(first, last) {}
-  // template< class Alloc >
-  // explicit stack( const Alloc& alloc );
-  // template< class Alloc >
-  // stack( const Container& cont, const Alloc& alloc );
-  // template< class Alloc >
-  // stack( Container&& cont, const Alloc& alloc );
-  // template< class Alloc >
-  // stack( const stack& other, const Alloc& alloc );
-  // template< class Alloc >
-  // stack( stack&& other, const Alloc& alloc );
-  // template< class InputIt, class Alloc >
-  // stack( InputIt first, InputIt last, const Alloc& alloc );
+
+  // the allocator is passed to the container, which should support it
+  template <class Alloc, typename = std::enable_if_t<
+                             std::uses_allocator_v<Container, Alloc>>>
+  explicit Stack(const Alloc& alloc) : stack_(alloc) {}
+  template <class Alloc, typename = std::enable_if_t<
+                             std::uses_allocator_v<Container, Alloc>>>
+  Stack(const Container& cont, const Alloc& alloc) : stack_(cont, alloc) {}
+  template <class Alloc, typename = std::enable_if_t<
+                             std::uses_allocator_v<Container, Alloc>>>
+  Stack(Container&& cont, const Alloc& alloc)
+      : stack_(std::move(cont), alloc) {}
+  template <class Alloc, typename = std::enable_if_t<
+                             std::uses_allocator_v<Container, Alloc>>>
+  Stack(const Stack& other, const Alloc& alloc) : stack_(other.stack_, alloc) {}
+  template <class Alloc, typename = std::enable_if_t<
+                             std::uses_allocator_v<Container, Alloc>>>
+  Stack(Stack&& other, const Alloc& alloc)
+      : stack_(std::move(other.stack_), alloc) {}
+  template <class InputIt, class Alloc,
+            typename = std::enable_if_t<
+                std::uses_allocator_v<Container, Alloc>>>
+  Stack(InputIt first, InputIt last, const Alloc& alloc)
+      : stack_(first, last, alloc) {}
 
   Stack& operator=(const Stack& other) = default;
   reference Top() { return *(stack_.rbegin()); }
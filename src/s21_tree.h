@@ -2,6 +2,8 @@
 #define _TESTS_S21_TREE_H_
 
 #include <cassert>
+#include <memory>
+#include <memory_resource>
 
 #include "s21_utility.h"
 #include "s21_vector.h"
@@ -323,10 +325,17 @@ class TreeReverseIterator
   }
 };
 
-template <typename Key, typename Value, typename Comparator>
-class Tree {
+template <typename Key, typename Value, typename Comparator,
+          typename Allocator = std::allocator<Value>>
+class Tree : private Utility::AllocatorHolder<Allocator> {
+  using node_allocator_type = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<NodeAVL<Value, std::size_t>>;
+  using node_deleter = Utility::AllocatorDelete<node_allocator_type>;
+  using traits = std::allocator_traits<Allocator>;
+
  public:
   using key_type = Key;
+  using allocator_type = Allocator;
   using value_type = Value;
   using size_type = std::size_t;
   using difference_type = std::ptrdiff_t;
@@ -340,16 +349,15 @@ class Tree {
   using const_node_pointer = const NodeAVL<value_type, size_type>*;
   using comparator = Comparator;
 
-  using node_handler = Utility::Handler<node_pointer, reference>;
+  using node_handler = Utility::Handler<node_pointer, reference, node_deleter>;
 
-  using iterator = TreeIterator<Tree<Key, Value, Comparator>>;
+  using iterator = TreeIterator<Tree>;
   using const_iterator =
-      TreeIterator<Tree<Key, Value, Comparator>, const_pointer, const_reference,
-                   const_node_pointer>;
-  using reverse_iterator = TreeReverseIterator<Tree<Key, Value, Comparator>>;
+      TreeIterator<Tree, const_pointer, const_reference, const_node_pointer>;
+  using reverse_iterator = TreeReverseIterator<Tree>;
   using const_reverse_iterator =
-      TreeReverseIterator<Tree<Key, Value, Comparator>, const_pointer,
-                          const_reference, const_node_pointer>;
+      TreeReverseIterator<Tree, const_pointer, const_reference,
+                          const_node_pointer>;
 
  private:
   size_type size_;
@@ -362,38 +370,83 @@ class Tree {
   comparator comparator_;
 
  public:
-  Tree() : size_{0ull}, root_{nullptr}, end_{}, rend_{} {
+  Tree() noexcept(noexcept(Allocator()))
+      : size_{0ull}, root_{nullptr}, end_{}, rend_{} {
+    updateEnd();
+    updateReverseEnd();
+  }
+  explicit Tree(const Allocator& allocator)
+      : Utility::AllocatorHolder<Allocator>(allocator),
+        size_{0ull},
+        root_{nullptr},
+        end_{},
+        rend_{} {
     updateEnd();
     updateReverseEnd();
   }
-  Tree(std::initializer_list<value_type> list) : Tree() {
+  Tree(std::initializer_list<value_type> list,
+       const Allocator& allocator = Allocator())
+      : Tree(allocator) {
     for (auto&& element : list) Insert(std::move(element));
   }
 
-  Tree(const Tree& other) : Tree() {
+  Tree(const Tree& other)
+      : Tree(other, traits::select_on_container_copy_construction(
+                        other.allocator())) {}
+  Tree(const Tree& other, const Allocator& allocator) : Tree(allocator) {
     if (!other.root_) return;
 
     root_ = copy_recursive(other.root_, nullptr, &(other.rend_), &(other.end_));
     updateEnd();
     updateReverseEnd();
   }
-  Tree(Tree&& other) noexcept : Tree() { *this = std::move(other); }
+  Tree(Tree&& other) noexcept : Tree(other.allocator()) { swapNodes(other); }
+  // nodes of other are taken only when they can be freed with the allocator,
+  // otherwise the values are moved one by one
+  Tree(Tree&& other, const Allocator& allocator) : Tree(allocator) {
+    if (this->allocator() == other.allocator()) {
+      swapNodes(other);
+      return;
+    }
+    for (auto it = other.begin(); it != other.end(); ++it)
+      Insert_back(std::move(*it));
+    other.Clear();
+  }
   Tree& operator=(const Tree& other) {
     if (this == &other) return *this;
 
-    Tree temporary(other);
-    *this = std::move(temporary);
+    constexpr bool propagate =
+        traits::propagate_on_container_copy_assignment::value;
+    Tree temporary(other, propagate ? other.allocator() : this->allocator());
+    Clear();
+    if constexpr (propagate) this->allocator() = temporary.allocator();
+    swapNodes(temporary);
     return *this;
   }
 
-  Tree& operator=(Tree&& other) noexcept {
+  Tree& operator=(Tree&& other) noexcept(
+      traits::propagate_on_container_move_assignment::value ||
+      traits::is_always_equal::value) {
     if (this == &other) return *this;
 
+    if constexpr (!traits::propagate_on_container_move_assignment::value) {
+      if (this->allocator() != other.allocator()) {
+        Tree temporary(std::move(other), this->allocator());
+        Clear();
+        swapNodes(temporary);
+        return *this;
+      }
+    }
+
     Clear();
-    Swap(other);
+    if constexpr (traits::propagate_on_container_move_assignment::value)
+      this->allocator() = std::move(other.allocator());
+    swapNodes(other);
 
     return *this;
   }
+
+  allocator_type Get_allocator() const noexcept { return this->allocator(); }
   ~Tree() { Clear(); }
   bool Empty() const noexcept { return size_ == 0ull; }
   size_type Size() const noexcept { return size_; }
@@ -405,35 +458,14 @@ class Tree {
   void Swap(Tree& other) noexcept {
     if (this == &other) return;
 
-    node_pointer begin = rend_.root_;
-    node_pointer rbegin = end_.root_;
-    node_pointer other_begin = other.rend_.root_;
-    node_pointer other_rbegin = other.end_.root_;
-
-    std::swap(root_, other.root_);
-    std::swap(size_, other.size_);
-
-    rend_.root_ = other_begin;
-    if (other_begin) other_begin->left_ = &rend_;
-
-    end_.root_ = other_rbegin;
-    if (other_rbegin) other_rbegin->right_ = &end_;
-
-    other.rend_.root_ = begin;
-    if (begin) begin->left_ = &(other.rend_);
-
-    other.end_.root_ = rbegin;
-    if (rbegin) rbegin->right_ = &(other.end_);
-
-    // set left and right to nullptr for end_ and rend_ if needed. They are not
-    // nullptr for empty tree to allow --begin() give rend_
-    updateEnd();
-    updateReverseEnd();
-
-    // set left and right to nullptr for end_ and rend_ if needed. They are not
-    // nullptr for empty tree to allow --begin() give rend_
-    other.updateEnd();
-    other.updateReverseEnd();
+    if constexpr (traits::propagate_on_container_swap::value) {
+      using std::swap;  // to enable ADL
+      swap(this->allocator(), other.allocator());
+    } else {
+      assert(this->allocator() == other.allocator() &&
+             "Swapping trees with unequal allocators!");
+    }
+    swapNodes(other);
   }
 
   // iterators============================================================
@@ -502,6 +534,21 @@ class Tree {
     }
     return {_, created};
   }
+  // value should be greater than all the others: it is attached to the last
+  // node and only the path above it is rebalanced, no comparisons are made
+  std::pair<iterator, bool> Insert_back(const_reference value) {
+    if (!root_) return Insert(value);
+    assert(comparator_(end_.root_->value_, value) &&
+           "Value should be the greatest!");
+    return {iterator(insert_back(create_node(end_.root_, value))), true};
+  }
+  std::pair<iterator, bool> Insert_back(value_type&& value) {
+    if (!root_) return Insert(std::move(value));
+    assert(comparator_(end_.root_->value_, value) &&
+           "Value should be the greatest!");
+    return {iterator(insert_back(create_node(end_.root_, std::move(value)))),
+            true};
+  }
   template <class... Args>
   Vector<std::pair<iterator, bool>> Insert_many(Args&&... args) {
     Vector<std::pair<iterator, bool>> result;
@@ -521,7 +568,7 @@ class Tree {
     if (!root_) assert(0 && "Trying to erase from empty tree!");
 
     std::pair<iterator, node_pointer> result = extract_recursive(root_, value);
-    delete result.second;
+    destroy_node(result.second);
     result.second = nullptr;
 
     return result.first;
@@ -529,7 +576,7 @@ class Tree {
   node_handler Extract(const_iterator pos) {
     if (!root_) assert(0 && "Trying to extract from empty tree!");
     const auto& [_, node] = extract_recursive(root_, *pos);
-    return node_handler(node);
+    return node_handler(node, node_deleter(node_allocator()));
   }
   node_handler Extract(iterator pos) {
     return Extract(static_cast<const_iterator>(pos));
@@ -537,7 +584,7 @@ class Tree {
   node_handler Extract(const_reference key) {
     if (!root_) assert(0 && "Trying to extract from empty tree!");
     const auto& [_, node] = extract_recursive(root_, key);
-    return node_handler(node);
+    return node_handler(node, node_deleter(node_allocator()));
   }
   iterator Find(const key_type& key) {
     if (!root_) return end();
@@ -584,6 +631,47 @@ class Tree {
   }
 
  private:
+  node_allocator_type node_allocator() const noexcept {
+    return node_allocator_type(this->allocator());
+  }
+  void destroy_node(node_pointer node) {
+    node_deleter deleter(node_allocator());
+    deleter(node);
+  }
+  // exchanges the nodes only, the allocators should be equal
+  void swapNodes(Tree& other) noexcept {
+    if (this == &other) return;
+
+    node_pointer begin = rend_.root_;
+    node_pointer rbegin = end_.root_;
+    node_pointer other_begin = other.rend_.root_;
+    node_pointer other_rbegin = other.end_.root_;
+
+    std::swap(root_, other.root_);
+    std::swap(size_, other.size_);
+
+    rend_.root_ = other_begin;
+    if (other_begin) other_begin->left_ = &rend_;
+
+    end_.root_ = other_rbegin;
+    if (other_rbegin) other_rbegin->right_ = &end_;
+
+    other.rend_.root_ = begin;
+    if (begin) begin->left_ = &(other.rend_);
+
+    other.end_.root_ = rbegin;
+    if (rbegin) rbegin->right_ = &(other.end_);
+
+    // set left and right to nullptr for end_ and rend_ if needed. They are not
+    // nullptr for empty tree to allow --begin() give rend_
+    updateEnd();
+    updateReverseEnd();
+
+    // set left and right to nullptr for end_ and rend_ if needed. They are not
+    // nullptr for empty tree to allow --begin() give rend_
+    other.updateEnd();
+    other.updateReverseEnd();
+  }
   node_pointer copy_recursive(node_pointer source,
                               node_pointer destination_root, node_pointer rend,
                               node_pointer end) {
@@ -608,16 +696,18 @@ class Tree {
     if ((*node)->right_ && (*node)->right_ != &end_)
       deallocate(&(*node)->right_);
 
-    delete *node;
+    destroy_node(*node);
     *node = nullptr;
   }
   node_pointer create_node(node_pointer root, value_type&& value) {
-    node_pointer new_node = new NodeAVL(std::move(value), root);
+    node_allocator_type allocator = node_allocator();
+    node_pointer new_node = Utility::Create(allocator, std::move(value), root);
     ++size_;
     return new_node;
   }
   node_pointer create_node(node_pointer root, const_reference value) {
-    node_pointer new_node = new NodeAVL(value, root);
+    node_allocator_type allocator = node_allocator();
+    node_pointer new_node = Utility::Create(allocator, value, root);
     ++size_;
     return new_node;
   }
@@ -664,13 +754,14 @@ class Tree {
   bool leftLeftCase(node_pointer root) const noexcept {
     if (root->lHeight_ - root->rHeight_ != 2ull) return false;
     if (!root->left_) return false;
-    if (root->left_->lHeight_ - root->left_->rHeight_ != 1ull) return false;
+    // equal heights of the child happen only after erasure
+    if (root->left_->lHeight_ < root->left_->rHeight_) return false;
     return true;
   }
   bool rightRightCase(node_pointer root) const noexcept {
     if (root->rHeight_ - root->lHeight_ != 2ull) return false;
     if (!root->right_) return false;
-    if (root->right_->rHeight_ - root->right_->lHeight_ != 1ull) return false;
+    if (root->right_->rHeight_ < root->right_->lHeight_) return false;
     return true;
   }
   bool leftRightCase(node_pointer root) const noexcept {
@@ -829,6 +920,26 @@ class Tree {
     }
   }
 
+  node_pointer insert_back(node_pointer new_node) {
+    new_node->root_->right_ = new_node;
+    new_node->right_ = &end_;
+    end_.root_ = new_node;
+
+    for (node_pointer node = new_node->root_; node;) {
+      node_pointer root = node->root_;
+      const size_type height =
+          node->lHeight_ > node->rHeight_ ? node->lHeight_ : node->rHeight_;
+      updateRightHeight(node);
+      if (unbalanced(node)) {
+        balance(node);  // restores the height the subtree had before
+        break;
+      }
+      if (node->rHeight_ <= height) break;  // the height did not change
+      node = root;
+    }
+    return new_node;
+  }
+
   std::pair<iterator, bool> insert_recursive(node_pointer root,
                                              const_reference value) {
     assert(root && "Root should always exist!");
@@ -1064,11 +1175,10 @@ class Tree {
     --size_;
 
     if (new_node && !new_node->root_) root_ = new_node;
+    if (root_ == result) root_ = nullptr;  // the only node was extracted
 
-    if (root_) {
-      updateEnd();
-      updateReverseEnd();
-    }
+    updateEnd();
+    updateReverseEnd();
 
     return std::make_pair(it_result, result);
   }
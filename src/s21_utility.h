@@ -1,24 +1,82 @@
 #ifndef _S21_UTILITY_H_
 #define _S21_UTILITY_H_
 
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
 namespace s21 {
 
 namespace Utility {
 
+// Keeps the allocator of a container. Being a base class it takes no space
+// when the allocator is empty like std::allocator
+template <typename Allocator>
+class AllocatorHolder : private Allocator {
+ public:
+  AllocatorHolder() noexcept(noexcept(Allocator())) : Allocator() {}
+  explicit AllocatorHolder(const Allocator& allocator) noexcept
+      : Allocator(allocator) {}
+
+ protected:
+  Allocator& allocator() noexcept { return *this; }
+  const Allocator& allocator() const noexcept { return *this; }
+};
+
+// Destroys and deallocates one node with the allocator it came from
+template <typename Allocator>
+class AllocatorDelete : private AllocatorHolder<Allocator> {
+  using traits = std::allocator_traits<Allocator>;
+
+ public:
+  AllocatorDelete() = default;
+  explicit AllocatorDelete(const Allocator& allocator) noexcept
+      : AllocatorHolder<Allocator>(allocator) {}
+
+  void operator()(typename traits::pointer pointer) {
+    traits::destroy(this->allocator(), pointer);
+    traits::deallocate(this->allocator(), pointer, 1ull);
+  }
+};
+
+// Allocates one node with the allocator and constructs it from args
+template <typename Allocator, class... Args>
+typename std::allocator_traits<Allocator>::pointer Create(Allocator& allocator,
+                                                          Args&&... args) {
+  using traits = std::allocator_traits<Allocator>;
+  typename traits::pointer pointer = traits::allocate(allocator, 1ull);
+  try {
+    traits::construct(allocator, pointer, std::forward<Args>(args)...);
+  } catch (...) {
+    traits::deallocate(allocator, pointer, 1ull);
+    throw;
+  }
+  return pointer;
+}
+
 // move-only
-template <typename NodePointer, typename ValueReference>
-class Handler {
+template <typename NodePointer, typename ValueReference,
+          typename Deleter =
+              std::default_delete<std::remove_pointer_t<NodePointer>>>
+class Handler : private Deleter {
  private:
   NodePointer pointer_;
 
  public:
-  Handler(NodePointer pointer) : pointer_{pointer} {}
+  Handler(NodePointer pointer, const Deleter& deleter = Deleter())
+      : Deleter(deleter), pointer_{pointer} {}
 
   Handler(const Handler& other) = delete;  // запретили создавать копированием
 
   Handler& operator=(const Handler& other) = delete;  // запретили копировать
 
-  Handler(Handler&& other) noexcept : pointer_{other.pointer_} {
+  Handler(Handler&& other) noexcept
+      : Deleter(std::move(other)), pointer_{other.pointer_} {
     other.pointer_ = nullptr;
   }
 
@@ -31,18 +89,307 @@ class Handler {
   Handler& operator=(Handler&& other) noexcept {
     if (this == &other) return *this;
 
-    this->~Handler();
+    release();
+    Deleter::operator=(std::move(other));
     pointer_ = other.pointer_;
     other.pointer_ = nullptr;
     return *this;
   }
 
-  ~Handler() {
-    delete pointer_;
+  ~Handler() { release(); }
+
+ private:
+  void release() {
+    if (pointer_) Deleter::operator()(pointer_);
     pointer_ = nullptr;
   }
 };
 
+// Allocator may resize a chunk keeping its contents, like MmapAllocator:
+// reallocate(pointer, old_count, new_count) gives the new chunk or nullptr
+// when it can not
+template <typename Allocator, typename = void>
+struct CanReallocate : std::false_type {};
+
+template <typename Allocator>
+struct CanReallocate<
+    Allocator, std::void_t<decltype(std::declval<Allocator&>().reallocate(
+                   std::declval<
+                       typename std::allocator_traits<Allocator>::pointer>(),
+                   std::size_t(), std::size_t()))>> : std::true_type {};
+
+// Copies count elements of source into uninitialized destination, the
+// ranges do not overlap. Trivially copyable types are copied bytewise at
+// once, the others one by one through the allocator; when a copy throws,
+// the copies made are destroyed
+template <typename Allocator, typename Type>
+void CopyConstruct(Allocator& allocator, const Type* source, std::size_t count,
+                   Type* destination) {
+  using traits = std::allocator_traits<Allocator>;
+  if (!count) return;
+
+  if constexpr (std::is_trivially_copyable_v<Type>) {
+    std::memcpy(static_cast<void*>(destination),
+                static_cast<const void*>(source), count * sizeof(Type));
+  } else {
+    std::size_t copied = 0ull;
+    try {
+      for (; copied < count; ++copied)
+        traits::construct(allocator, destination + copied, source[copied]);
+    } catch (...) {
+      for (std::size_t i = 0ull; i < copied; ++i)
+        traits::destroy(allocator, destination + i);
+      throw;
+    }
+  }
+}
+
+// Constructs count elements at first by construct_one(element) or, when one
+// of them throws, none: the ones made are destroyed
+template <typename Allocator, typename Type, typename Function>
+void ConstructEach(Allocator& allocator, Type* first, std::size_t count,
+                   Function&& construct_one) {
+  using traits = std::allocator_traits<Allocator>;
+  std::size_t constructed = 0ull;
+  try {
+    for (; constructed < count; ++constructed)
+      construct_one(first + constructed);
+  } catch (...) {
+    for (std::size_t i = 0ull; i < constructed; ++i)
+      traits::destroy(allocator, first + i);
+    throw;
+  }
+}
+
+// Moving elements of the type through the allocator can not throw: either
+// they are moved bytewise or their move constructor is noexcept
+template <typename Type>
+constexpr bool kNothrowRelocatable = std::is_trivially_copyable_v<Type> ||
+                                     std::is_nothrow_move_constructible_v<Type>;
+
+template <typename Allocator, typename Type>
+void Destroy(Allocator& allocator, Type* first, std::size_t count) noexcept {
+  if constexpr (!std::is_trivially_destructible_v<Type>)
+    for (std::size_t i = 0ull; i < count; ++i)
+      std::allocator_traits<Allocator>::destroy(allocator, first + i);
+}
+
+// Constructs count elements at uninitialized destination from the ones of
+// source, the ranges do not overlap: bytewise for trivially copyable types,
+// otherwise with move_if_noexcept, all of them or none. source is left
+// constructed
+template <typename Allocator, typename Type>
+void MoveConstruct(Allocator& allocator, Type* source, std::size_t count,
+                   Type* destination) {
+  if (!count) return;
+
+  if constexpr (std::is_trivially_copyable_v<Type>) {
+    std::memcpy(static_cast<void*>(destination),
+                static_cast<const void*>(source), count * sizeof(Type));
+  } else {
+    ConstructEach(allocator, destination, count, [&](Type* element) {
+      std::allocator_traits<Allocator>::construct(
+          allocator, element,
+          std::move_if_noexcept(source[element - destination]));
+    });
+  }
+}
+
+// Moves count elements from source to uninitialized destination leaving
+// source uninitialized, the ranges do not overlap. All of them are made
+// before any source is destroyed, so when one throws the elements stay in
+// source
+template <typename Allocator, typename Type>
+void Relocate(Allocator& allocator, Type* source, std::size_t count,
+              Type* destination) {
+  MoveConstruct(allocator, source, count, destination);
+  Destroy(allocator, source, count);
+}
+
+// Relocate within one array, the ranges may overlap; only for the types
+// which relocate without throwing, as an element moved halfway could not
+// be taken back
+template <typename Allocator, typename Type>
+void Shift(Allocator& allocator, Type* source, std::size_t count,
+           Type* destination) noexcept {
+  static_assert(kNothrowRelocatable<Type>, "Shifting may throw!");
+  using traits = std::allocator_traits<Allocator>;
+  if (!count || source == destination) return;
+
+  if constexpr (std::is_trivially_copyable_v<Type>) {
+    std::memmove(static_cast<void*>(destination),
+                 static_cast<const void*>(source), count * sizeof(Type));
+  } else if (destination < source) {
+    for (std::size_t i = 0ull; i < count; ++i) {
+      traits::construct(allocator, destination + i, std::move(source[i]));
+      traits::destroy(allocator, source + i);
+    }
+  } else {
+    for (std::size_t i = count; i > 0ull; --i) {
+      const std::size_t index = i - 1ull;
+      traits::construct(allocator, destination + index,
+                        std::move(source[index]));
+      traits::destroy(allocator, source + index);
+    }
+  }
+}
+
+// Erases count elements at first, the tail ones after them take their
+// place. The types whose move may throw are move assigned down the way
+// std::vector does, so a throw leaves every slot constructed
+template <typename Allocator, typename Type>
+void EraseInPlace(Allocator& allocator, Type* first, std::size_t count,
+                  std::size_t tail) {
+  if constexpr (kNothrowRelocatable<Type>) {
+    Destroy(allocator, first, count);
+    Shift(allocator, first + count, tail, first);
+  } else {
+    std::move(first + count, first + count + tail, first);
+    Destroy(allocator, first + tail, count);
+  }
+}
+
+// some of args lies in [first, last): an element or a member of one, which
+// moves when the elements do
+template <typename Type, typename... Args>
+bool RefersTo(const Type* first, const Type* last,
+              const Args&... args) noexcept {
+  const std::less<const void*> less;
+  const auto inside = [&](const void* address) {
+    return !less(address, first) && less(address, last);
+  };
+  return (inside(std::addressof(args)) || ...);
+}
+
+// An element made through the allocator apart from the container, to keep
+// the arguments which refer to elements about to move
+template <typename Allocator>
+class Temporary {
+  using traits = std::allocator_traits<Allocator>;
+  using value_type = typename traits::value_type;
+
+ public:
+  template <typename... Args>
+  explicit Temporary(Allocator& allocator, Args&&... args)
+      : allocator_{allocator} {
+    traits::construct(allocator_, pointer(), std::forward<Args>(args)...);
+  }
+  Temporary(const Temporary&) = delete;
+  Temporary& operator=(const Temporary&) = delete;
+  ~Temporary() { traits::destroy(allocator_, pointer()); }
+
+  value_type& Get() noexcept { return *pointer(); }
+
+ private:
+  value_type* pointer() noexcept {
+    return std::launder(reinterpret_cast<value_type*>(storage_));
+  }
+
+  Allocator& allocator_;
+  alignas(value_type) unsigned char storage_[sizeof(value_type)];
+};
+
+// Insertion into a vector with room for count more elements: the tail of
+// the elements from position on is shifted up once and construct(position)
+// fills the gap with all count elements or none, in which case the tail
+// goes back. The arguments of construct should not refer to the tail. Only
+// for the types which relocate without throwing (see InsertsInPlace)
+template <typename Allocator, typename Type, typename Constructor>
+void InsertInPlace(Allocator& allocator, Type* position, std::size_t tail,
+                   std::size_t count, Constructor&& construct) {
+  if constexpr (!kNothrowRelocatable<Type>) {
+    assert(!tail && "Shifting may throw!");
+    construct(position);
+  } else {
+    Shift(allocator, position, tail, position + count);
+    try {
+      construct(position);
+    } catch (...) {
+      Shift(allocator, position + count, tail, position);
+      throw;
+    }
+  }
+}
+
+// InsertInPlace can make room at index of a vector with size elements: when
+// the elements may throw on the way the tail is not shifted but everything
+// goes to new memory through InsertRelocating
+template <typename Type>
+bool InsertsInPlace(std::size_t index, std::size_t size) noexcept {
+  return kNothrowRelocatable<Type> || index == size;
+}
+
+// Insertion on reallocation: construct(new_data + index) fills the gap in
+// the new memory first, so its arguments may refer to the elements, then
+// the size elements are made around it and only after all of them the old
+// ones are destroyed. The old memory is left for the caller to free. When
+// anything throws nothing changes
+template <typename Allocator, typename Type, typename Constructor>
+Type* InsertRelocating(Allocator& allocator, Type* data, std::size_t size,
+                       std::size_t index, std::size_t count,
+                       std::size_t new_capacity, Constructor&& construct) {
+  using traits = std::allocator_traits<Allocator>;
+  Type* new_data = traits::allocate(allocator, new_capacity);
+  try {
+    construct(new_data + index);
+    try {
+      MoveConstruct(allocator, data, index, new_data);
+      try {
+        MoveConstruct(allocator, data + index, size - index,
+                      new_data + index + count);
+      } catch (...) {
+        Destroy(allocator, new_data, index);
+        throw;
+      }
+    } catch (...) {
+      Destroy(allocator, new_data + index, count);
+      throw;
+    }
+  } catch (...) {
+    traits::deallocate(allocator, new_data, new_capacity);
+    throw;
+  }
+  Destroy(allocator, data, size);
+  return new_data;
+}
+
+// Index arithmetic of storage made of blocks of FirstBlock, 2 * FirstBlock,
+// 4 * FirstBlock ... elements: block k keeps the elements from
+// FirstBlock * (2^k - 1) on, so any index is found in O(1)
+template <std::size_t FirstBlock>
+struct GeometricBlocks {
+  static_assert(FirstBlock && !(FirstBlock & (FirstBlock - 1ull)),
+                "FirstBlock should be a power of two!");
+
+  static constexpr std::size_t kFirstShift = [] {
+    std::size_t shift = 0ull;
+    while ((1ull << shift) < FirstBlock) ++shift;
+    return shift;
+  }();
+  static constexpr std::size_t kMaxBlocks = 64ull - kFirstShift;
+
+  static std::size_t Block(std::size_t pos) noexcept {
+    return 63ull - static_cast<std::size_t>(
+                       __builtin_clzll((pos >> kFirstShift) + 1ull));
+  }
+  static std::size_t Start(std::size_t k) noexcept {
+    return ((1ull << k) - 1ull) << kFirstShift;
+  }
+  static std::size_t Size(std::size_t k) noexcept { return FirstBlock << k; }
+  static std::size_t Offset(std::size_t pos) noexcept {
+    return pos - Start(Block(pos));
+  }
+};
+
+// projection which gives the element itself
+class Identity {
+ public:
+  template <typename Type>
+  constexpr Type&& operator()(Type&& value) const noexcept {
+    return std::forward<Type>(value);
+  }
+};
+
 template <typename Key>
 class Less {
  public:
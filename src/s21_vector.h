@@ -1,10 +1,16 @@
 #ifndef _S21_VECTOR_H_
 #define _S21_VECTOR_H_
 
+#include <algorithm>
 #include <cassert>
 #include <initializer_list>
 #include <iterator>
+#include <memory>
+#include <memory_resource>
 #include <new>
+#include <type_traits>
+
+#include "s21_utility.h"
 
 namespace s21 {
 
@@ -292,9 +298,255 @@ class VectorReverseIterator
   }
 };
 
-template <typename Type>
-class Vector {
+// Growth policies: Next(capacity, required, element_size) gives the capacity
+// to allocate when required elements do not fit into capacity
+namespace Growth {
+
+// 2^k - 1
+class PowerOfTwo {
+ public:
+  static std::size_t Next(std::size_t, std::size_t required,
+                          std::size_t) noexcept {
+    std::size_t result = 1ull;
+    while (result <= required) result <<= 1ull;
+    return result - 1ull;
+  }
+};
+
+// 1.5 times, the waste is at most a third of the memory
+class Geometric {
+ public:
+  static std::size_t Next(std::size_t capacity, std::size_t required,
+                          std::size_t) noexcept {
+    const std::size_t result = capacity + capacity / 2ull;
+    return result < required ? required : result;
+  }
+};
+
+// exactly as many as required, every growth reallocates
+class Exact {
+ public:
+  static std::size_t Next(std::size_t, std::size_t required,
+                          std::size_t) noexcept {
+    return required;
+  }
+};
+
+// 1.5 times rounded up to whole pages, so the tail of the last page is used
+template <std::size_t PageSize = 4096ull>
+class Page {
  public:
+  static std::size_t Next(std::size_t capacity, std::size_t required,
+                          std::size_t element_size) noexcept {
+    const std::size_t count =
+        Geometric::Next(capacity, required, element_size);
+    const std::size_t pages =
+        (count * element_size + PageSize - 1ull) / PageSize;
+    return pages * PageSize / element_size;
+  }
+};
+
+}  // namespace Growth
+
+namespace VectorDetail {
+
+// Insertion, erasure and resizing shared by Vector and SmallVector, on
+// indices rather than iterators (CRTP). Derived makes it a friend and has
+// data_, size_, capacity_, allocator(), Reserve, calculate_capacity and
+// adopt(new_data, new_capacity), which frees the memory it had. The
+// functions give the position of the first element made
+template <typename Derived, typename Type, typename Allocator>
+class Modifiers {
+  using traits = std::allocator_traits<Allocator>;
+  using temporary_type = Utility::Temporary<Allocator>;
+
+ protected:
+  Type* insertCopies(std::size_t index, std::size_t count, const Type& value) {
+    if (shifts(index, count) && refersToElements(value)) {
+      temporary_type temporary(self().allocator(), value);
+      return insertCopies(index, count, temporary.Get());
+    }
+    return insert(index, count, [this, count, &value](Type* room) {
+      Utility::ConstructEach(
+          self().allocator(), room, count, [this, &value](Type* element) {
+            traits::construct(self().allocator(), element, value);
+          });
+    });
+  }
+
+  // count elements from first on
+  template <typename InputIt>
+  Type* insertRange(std::size_t index, InputIt first, std::size_t count) {
+    return insert(index, count, [this, count, &first](Type* room) {
+      Utility::ConstructEach(
+          self().allocator(), room, count, [this, &first](Type* element) {
+            traits::construct(self().allocator(), element, *first);
+            ++first;
+          });
+    });
+  }
+
+  // one element of each of args, constructed right in its place
+  template <typename... Args>
+  Type* insertMany(std::size_t index, Args&&... args) {
+    constexpr std::size_t count = sizeof...(Args);
+    if constexpr (count == 0ull) {
+      return self().data_ + index;
+    } else {
+      if (shifts(index, count) && refersToElements(args...)) {
+        temporary_type temporaries[] = {
+            temporary_type(self().allocator(), std::forward<Args>(args))...};
+        return insertMoving(index, temporaries, count);
+      }
+      return insert(index, count, [this, &args...](Type* room) {
+        Type* element = room;
+        try {
+          ((traits::construct(self().allocator(), element,
+                              std::forward<Args>(args)),
+            ++element),
+           ...);
+        } catch (...) {
+          while (element != room)
+            traits::destroy(self().allocator(), --element);
+          throw;
+        }
+      });
+    }
+  }
+
+  // one element made of all of args
+  template <typename... Args>
+  Type* emplace(std::size_t index, Args&&... args) {
+    if constexpr (sizeof...(Args) > 0ull) {
+      if (shifts(index, 1ull) && refersToElements(args...)) {
+        temporary_type temporary(self().allocator(),
+                                 std::forward<Args>(args)...);
+        return insertMoving(index, &temporary, 1ull);
+      }
+    }
+    return insert(index, 1ull, [this, &args...](Type* room) {
+      traits::construct(self().allocator(), room, std::forward<Args>(args)...);
+    });
+  }
+
+  // the elements after the count ones at index take their place
+  Type* erase(std::size_t index, std::size_t count) {
+    Derived& vector = self();
+    Type* first = vector.data_ + index;
+    if (!count) return first;
+    Utility::EraseInPlace(vector.allocator(), first, count,
+                          vector.size_ - index - count);
+    vector.size_ -= count;
+    return first;
+  }
+
+  // exactly count elements, the new ones made by construct_one(element);
+  // shrinking destroys the tail
+  template <typename Function>
+  void resize(std::size_t count, Function&& construct_one) {
+    Derived& vector = self();
+    if (count <= vector.size_) {
+      Utility::Destroy(vector.allocator(), vector.data_ + count,
+                       vector.size_ - count);
+      vector.size_ = count;
+      return;
+    }
+
+    vector.Reserve(count);
+    Utility::ConstructEach(vector.allocator(), vector.data_ + vector.size_,
+                           count - vector.size_, construct_one);
+    vector.size_ = count;
+  }
+
+ private:
+  Derived& self() noexcept { return static_cast<Derived&>(*this); }
+  const Derived& self() const noexcept {
+    return static_cast<const Derived&>(*this);
+  }
+
+  // makes room for count elements at index and fills it with
+  // construct(room), which constructs all of them or none. On reallocation
+  // the room is filled in the new memory first, so the arguments may still
+  // refer to the elements, and then every element is relocated once around
+  // the room. Otherwise only the tail after index is relocated, once, before
+  // the room is filled: the callers pass the arguments which refer to the
+  // elements through temporaries (see shifts). A tail whose moves may throw
+  // goes to new memory of the same capacity instead, so a throw changes
+  // nothing
+  template <typename Constructor>
+  Type* insert(std::size_t index, std::size_t count, Constructor&& construct) {
+    Derived& vector = self();
+    if (!count) return vector.data_ + index;
+
+    const std::size_t new_size = vector.size_ + count;
+    if (new_size > vector.capacity_ ||
+        !Utility::InsertsInPlace<Type>(index, vector.size_)) {
+      const std::size_t new_capacity =
+          new_size > vector.capacity_
+              ? Derived::calculate_capacity(vector.capacity_, new_size)
+              : vector.capacity_;
+      vector.adopt(Utility::InsertRelocating(vector.allocator(), vector.data_,
+                                             vector.size_, index, count,
+                                             new_capacity, construct),
+                   new_capacity);
+    } else {
+      Utility::InsertInPlace(vector.allocator(), vector.data_ + index,
+                             vector.size_ - index, count, construct);
+    }
+    vector.size_ = new_size;
+    return vector.data_ + index;
+  }
+  // count elements moved from the temporaries
+  Type* insertMoving(std::size_t index, temporary_type* temporaries,
+                     std::size_t count) {
+    return insert(index, count, [this, temporaries, count](Type* room) {
+      Utility::ConstructEach(
+          self().allocator(), room, count, [&](Type* element) {
+            traits::construct(self().allocator(), element,
+                              std::move(temporaries[element - room].Get()));
+          });
+    });
+  }
+  // inserting count elements at index moves the elements after it before
+  // the new ones are constructed
+  bool shifts(std::size_t index, std::size_t count) const noexcept {
+    const Derived& vector = self();
+    return index != vector.size_ && vector.size_ + count <= vector.capacity_;
+  }
+  template <typename... Args>
+  bool refersToElements(const Args&... args) const noexcept {
+    const Derived& vector = self();
+    return Utility::RefersTo(vector.data_, vector.data_ + vector.size_,
+                             args...);
+  }
+};
+
+// element by element, for the containers with Size() and cbegin()
+template <typename Container>
+bool Equal(const Container& left, const Container& right) {
+  return left.Size() == right.Size() &&
+         std::equal(left.cbegin(), left.cend(), right.cbegin());
+}
+
+}  // namespace VectorDetail
+
+// s21_span.h, included at the end
+inline constexpr std::size_t kDynamicExtent = static_cast<std::size_t>(-1);
+
+template <typename Type, std::size_t Extent = kDynamicExtent>
+class Span;
+
+template <typename Type, typename GrowthPolicy = Growth::PowerOfTwo,
+          typename Allocator = std::allocator<Type>>
+class Vector : private Utility::AllocatorHolder<Allocator>,
+               private VectorDetail::Modifiers<Vector<Type, GrowthPolicy,
+                                                      Allocator>,
+                                               Type, Allocator> {
+  using traits = std::allocator_traits<Allocator>;
+  friend VectorDetail::Modifiers<Vector, Type, Allocator>;
+
+ public:
+  using allocator_type = Allocator;
   using value_type = Type;
   using size_type = std::size_t;
   using difference_type = std::ptrdiff_t;
@@ -305,12 +557,11 @@ class Vector {
   using const_pointer = const value_type*;
 
  public:
-  using iterator = VectorIterator<Vector<Type> >;
-  using const_iterator =
-      VectorIterator<Vector<Type>, const_pointer, const_reference>;
-  using reverse_iterator = VectorReverseIterator<Vector<Type> >;
+  using iterator = VectorIterator<Vector>;
+  using const_iterator = VectorIterator<Vector, const_pointer, const_reference>;
+  using reverse_iterator = VectorReverseIterator<Vector>;
   using const_reverse_iterator =
-      VectorReverseIterator<Vector<Type>, const_pointer, const_reference>;
+      VectorReverseIterator<Vector, const_pointer, const_reference>;
 
  private:
   size_type capacity_;
@@ -318,103 +569,163 @@ class Vector {
   pointer data_;
 
  public:
-  Vector() : capacity_{0ull}, size_{0ull}, data_{nullptr} {}
-
-  explicit Vector(size_type count, const_reference value)
-      : capacity_{calculate_capacity(count)}, size_{count}, data_{nullptr} {
-    allocate(capacity_);
-
-    for (size_type i = 0ull; i < count; ++i) new (data_ + i) value_type(value);
+  Vector() noexcept(noexcept(Allocator()))
+      : capacity_{0ull}, size_{0ull}, data_{nullptr} {}
+  explicit Vector(const Allocator& allocator) noexcept
+      : Utility::AllocatorHolder<Allocator>(allocator),
+        capacity_{0ull},
+        size_{0ull},
+        data_{nullptr} {}
+
+  explicit Vector(size_type count, const_reference value,
+                  const Allocator& allocator = Allocator())
+      : Vector(allocator) {
+    allocate(calculate_capacity(0ull, count));
+
+    for (; size_ < count; ++size_)
+      traits::construct(this->allocator(), data_ + size_, value);
   }
   ~Vector() { deallocate(); }
 
-  Vector(std::initializer_list<value_type> initializer)
-      : capacity_{calculate_capacity(initializer.size())},
-        size_{initializer.size()},
-        data_{nullptr} {
-    allocate(capacity_);
+  Vector(std::initializer_list<value_type> initializer,
+         const Allocator& allocator = Allocator())
+      : Vector(allocator) {
+    allocate(calculate_capacity(0ull, initializer.size()));
 
-    size_type i = 0ull;
     for (auto&& element : initializer) {
-      new (data_ + i) value_type(std::move(element));
-      ++i;
+      traits::construct(this->allocator(), data_ + size_, std::move(element));
+      ++size_;
     }
   }
 
   Vector(Vector&& other) noexcept
-      : capacity_{other.capacity_}, size_{other.size_}, data_{other.data_} {
-    other.data_ = nullptr;
-    other.size_ = 0ull;
-    other.capacity_ = 0ull;
+      : Utility::AllocatorHolder<Allocator>(std::move(other.allocator())),
+        capacity_{0ull},
+        size_{0ull},
+        data_{nullptr} {
+    steal(other);
+  }
+  // memory of other is taken only when it can be freed with the allocator,
+  // otherwise the elements are moved one by one
+  Vector(Vector&& other, const Allocator& allocator) : Vector(allocator) {
+    if (this->allocator() == other.allocator()) {
+      steal(other);
+      return;
+    }
+    allocate(other.size_);
+    for (; size_ < other.size_; ++size_)
+      traits::construct(this->allocator(), data_ + size_,
+                        std::move(other.data_[size_]));
   }
 
-  Vector(const Vector& other) : Vector() {
-    char* preallocated_buffer =
-        new char[sizeof(value_type) *
-                 other.size_];  // no constructors were called
-    pointer new_data = reinterpret_cast<pointer>(preallocated_buffer);
-    for (size_type i = 0ull; i < other.size_; ++i)
-      new (new_data + i) value_type(other.data_[i]);
+  Vector(const Vector& other)
+      : Vector(other, traits::select_on_container_copy_construction(
+                          other.allocator())) {}
+  Vector(const Vector& other, const Allocator& allocator) : Vector(allocator) {
+    allocate(other.size_);
+    for (; size_ < other.size_; ++size_)
+      traits::construct(this->allocator(), data_ + size_, other.data_[size_]);
+  }
 
-    data_ = new_data;
-    size_ = other.size_;
-    capacity_ = size_;
+  // element i is made of generator(i), without a default value first
+  template <typename Generator,
+            typename = std::enable_if_t<
+                std::is_invocable_r_v<value_type, Generator&, size_type>>>
+  Vector(size_type count, Generator generator,
+         const Allocator& allocator = Allocator())
+      : Vector(allocator) {
+    allocate(calculate_capacity(0ull, count));
+
+    for (; size_ < count; ++size_)
+      traits::construct(this->allocator(), data_ + size_, generator(size_));
   }
 
   template <typename InputIt>
-  constexpr Vector(InputIt first, InputIt last) : Vector() {
+  constexpr Vector(InputIt first, InputIt last,
+                   const Allocator& allocator = Allocator())
+      : Vector(allocator) {
     const size_type count = getDistance(first, last);
-    capacity_ = calculate_capacity(count);
-    allocate(capacity_);
+    allocate(calculate_capacity(0ull, count));
 
-    size_type i = 0ull;
     while (first != last) {
-      new (data_ + i) value_type(*first);
+      traits::construct(this->allocator(), data_ + size_, *first);
 
-      ++i;
+      ++size_;
       ++first;
     }
-    size_ = count;
   }
 
+  // one bulk copy of contiguous elements: of another Vector, an Array, a
+  // part of them or a buffer
+  explicit Vector(Span<const value_type> span,
+                  const Allocator& allocator = Allocator())
+      : Vector(allocator) {
+    allocate(calculate_capacity(0ull, span.Size()));
+    Utility::CopyConstruct(this->allocator(), span.Data(), span.Size(), data_);
+    size_ = span.Size();
+  }
+
+  // the memory is kept when other fits into it and the allocator stays:
+  // the common elements are assigned, the rest are copied or destroyed.
+  // Then a throwing copy leaves a valid vector with some of the elements
+  // assigned; a new chunk is allocated only to grow
   Vector& operator=(const Vector& other) {
     // using namespace std;    // to enable ADL
     if (this == &other) return *this;
 
-    Vector temporary(other);
-    *this = std::move(temporary);
+    constexpr bool propagate =
+        traits::propagate_on_container_copy_assignment::value;
+    if (other.size_ <= capacity_ &&
+        (!propagate || this->allocator() == other.allocator())) {
+      if constexpr (propagate) this->allocator() = other.allocator();
+      assignInPlace(other);
+      return *this;
+    }
+
+    Vector temporary(other, propagate ? other.allocator() : this->allocator());
+    deallocate();
+    if constexpr (propagate) this->allocator() = temporary.allocator();
+    steal(temporary);
     return *this;
   }
 
-  Vector& operator=(Vector&& other) noexcept {
+  Vector& operator=(Vector&& other) noexcept(
+      traits::propagate_on_container_move_assignment::value ||
+      traits::is_always_equal::value) {
     if (this == &other) return *this;
 
-    deallocate();
-
-    data_ = other.data_;
-    size_ = other.size_;
-    capacity_ = other.capacity_;
+    if constexpr (!traits::propagate_on_container_move_assignment::value) {
+      if (this->allocator() != other.allocator()) {
+        Vector temporary(std::move(other), this->allocator());
+        deallocate();
+        steal(temporary);
+        return *this;
+      }
+    }
 
-    other.data_ = nullptr;
-    other.size_ = 0ull;
-    other.capacity_ = 0ull;
+    deallocate();
+    if constexpr (traits::propagate_on_container_move_assignment::value)
+      this->allocator() = std::move(other.allocator());
+    steal(other);
 
     return *this;
   }
 
+  allocator_type Get_allocator() const noexcept { return this->allocator(); }
+
   constexpr void Assign(size_type count, const_reference value) {
-    Vector temporary(count, value);
+    Vector temporary(count, value, this->allocator());
     *this = std::move(temporary);
   }
 
   template <typename InputIt>
   constexpr void Assign(InputIt first, InputIt last) {
-    Vector temporary(first, last);
+    Vector temporary(first, last, this->allocator());
     *this = std::move(temporary);
   }
 
   constexpr void Assign(std::initializer_list<value_type> list) {
-    Vector temporary(std::move(list));
+    Vector temporary(std::move(list), this->allocator());
     *this = std::move(temporary);
   }
 
@@ -442,11 +753,15 @@ class Vector {
   size_type Size() const noexcept { return size_; }
   size_type Capacity() const noexcept { return capacity_; }
 
+  // bytes allocated but not used by elements
+  size_type Capacity_waste() const noexcept {
+    return (capacity_ - size_) * sizeof(value_type);
+  }
+
+  // exactly new_capacity, the growth policy is not applied
   constexpr void Reserve(size_type new_capacity) {
     if (new_capacity <= capacity_) return;
-
-    const size_type new_actual_capacity = calculate_capacity(new_capacity);
-    reallocate(new_actual_capacity);
+    reallocate(new_capacity);
   }
 
   constexpr void Shrink_to_fit() {
@@ -485,42 +800,29 @@ class Vector {
   }
 
   constexpr iterator Insert(const_iterator pos, value_type&& value) {
-    const size_type new_size = size_ + 1ull;
-    checkReallocateUpdatingIterator(new_size, pos);
-    auto it = shiftBack(1ull, pos);
-    // for *it no constructors were called:
-    // *it = std::move(value);  // incorrect, *it was not constructed
-    new (it.operator->()) value_type(std::move(value));
-    return it;
+    return Emplace(pos, std::move(value));
   }
 
   constexpr iterator Insert(const_iterator pos, size_type count,
                             const_reference value) {
-    const size_type new_size = size_ + count;
-    checkReallocateUpdatingIterator(new_size, pos);
-    auto it = shiftBack(count, pos);
-    const auto it_result = it;
-    for (size_type i = 0ull; i < count; ++i) {
-      new (it.operator->()) value_type(value);
-      ++it;
-    }
-
-    return it_result;
+    return iterator(this->insertCopies(pos - cbegin(), count, value));
   }
 
   template <class... Args>
   void Insert_many_back(Args&&... args) {
-    return insert_many_back(std::forward<Args>(args)...);
+    Insert_many(cend(), std::forward<Args>(args)...);
   }
   void Insert_many_back() {
     return;
   }
 
+  // the elements are constructed right in their places, returns the position
+  // after them
   template <typename... Args>
   iterator Insert_many(const_iterator pos, Args&&... args) {
-    const auto shift = sizeof...(Args);
-    iterator it = insert_many(pos, std::forward<Args>(args)...);
-    return it + shift;
+    return iterator(this->insertMany(pos - cbegin(),
+                                     std::forward<Args>(args)...) +
+                    sizeof...(Args));
   }
   template <typename... Args>
   iterator Insert_many(iterator pos, Args&&... args) {
@@ -537,56 +839,29 @@ class Vector {
  public:
   template <class InputIt>
   constexpr iterator Insert(const_iterator pos, InputIt first, InputIt last) {
-    const size_type count = getDistance(first, last);
-    const size_type new_size = size_ + count;
-    checkReallocateUpdatingIterator(new_size, pos);
-    auto it = shiftBack(count, pos);
-    const auto it_result = it;
-
-    while (first != last) {
-      new (it.operator->()) value_type(*first);
-      ++it;
-      ++first;
-    }
-
-    return it_result;
+    return iterator(
+        this->insertRange(pos - cbegin(), first, getDistance(first, last)));
   }
 
   constexpr iterator Insert(const_iterator pos,
                             std::initializer_list<value_type> list) {
-    const size_type new_size = size_ + list.size();
-    checkReallocateUpdatingIterator(new_size, pos);
-    auto it = shiftBack(list.size(), pos);
-    const auto it_result = it;
-    for (auto&& element : list) {
-      // incorrect: no constructors for *it were called:
-      // *it = std::move(element);  // incorrect
-      new (it.operator->()) value_type(std::move(element));
-      ++it;
-    }
-
-    return it_result;
+    return Insert(pos, list.begin(), list.end());
   }
 
   template <class... Args>
   constexpr iterator Emplace(const_iterator pos, Args&&... args) {
-    const size_type new_size = size_ + 1ull;
-    checkReallocateUpdatingIterator(new_size, pos);
-    auto it = shiftBack(1ull, pos);
-    // incorrect: no constructors for *it were called:
-    // *it = value_type(std::forward<Args>(args)...); // incorrect
-    new (it.operator->()) value_type(std::forward<Args>(args)...);
-    return it;
+    return iterator(
+        this->emplace(pos - cbegin(), std::forward<Args>(args)...));
   }
 
  private:
  public:
   constexpr iterator Erase(const_iterator pos) {
-    return shiftForward(1ull, pos + 1ull);
+    return iterator(this->erase(pos - cbegin(), 1ull));
   }
 
   constexpr iterator Erase(const_iterator first, const_iterator last) {
-    return shiftForward(last - first, last);
+    return iterator(this->erase(first - cbegin(), last - first));
   }
 
   constexpr void Push_back(const_reference element) {
@@ -594,10 +869,10 @@ class Vector {
     size_type new_size = size_ + 1ull;
 
     if (new_size > capacity_) {
-      size_type new_capacity = calculate_capacity(new_size);
+      size_type new_capacity = calculate_capacity(capacity_, new_size);
       reallocate(new_capacity);
     }
-    new (data_ + old_size) value_type(element);
+    traits::construct(this->allocator(), data_ + old_size, element);
     size_ = new_size;
   };
 
@@ -606,36 +881,62 @@ class Vector {
     size_type new_size = size_ + 1ull;
 
     if (new_size > capacity_) {
-      size_type new_capacity = calculate_capacity(new_size);
+      size_type new_capacity = calculate_capacity(capacity_, new_size);
       reallocate(new_capacity);
     }
     // data_[old_size] = std::move(element);
-    new (data_ + old_size) value_type(std::move(element));
+    traits::construct(this->allocator(), data_ + old_size, std::move(element));
     size_ = new_size;
   };
 
+  // copies span to the end at once; span may be a part of this Vector
+  void Append(Span<const value_type> span) {
+    const size_type count = span.Size();
+    if (!count) return;
+
+    const_pointer source = span.Data();
+    if (size_ + count > capacity_) {
+      const bool inside = source >= data_ && source < data_ + size_;
+      const size_type offset = inside ? source - data_ : 0ull;
+      reallocate(calculate_capacity(capacity_, size_ + count));
+      if (inside) source = data_ + offset;
+    }
+    Utility::CopyConstruct(this->allocator(), source, count, data_ + size_);
+    size_ += count;
+  }
+
   constexpr void Pop_back() {
     assert(size_ && "Pop_back from empty vector!");
-    (end() - 1ull)->~value_type();
+    traits::destroy(this->allocator(), data_ + size_ - 1ull);
     --size_;
   }
 
-  constexpr void Resize(size_type count) { Resize(count, value_type()); }
+  // new elements are value-initialized: zeros for arithmetic types
+  constexpr void Resize(size_type count) {
+    this->resize(count, [this](pointer element) {
+      traits::construct(this->allocator(), element);
+    });
+  }
   constexpr void Resize(size_type count, const_reference value) {
-    if (count == size_) return;
-
-    if (count < size_) {
-      for (iterator it = iterator(data_ + count); it < end(); ++it)
-        it->~value_type();
-      size_ = count;
-      return;
-    }
-
-    Reserve(count);
-
-    for (size_type i = size_; i < count; ++i) Push_back(value);
+    this->resize(count, [this, &value](pointer element) {
+      traits::construct(this->allocator(), element, value);
+    });
+  }
+  // new elements are default-initialized: trivial types are not zeroed, for
+  // buffers which are overwritten anyway
+  void Resize_default_init(size_type count) {
+    this->resize(count, [this](pointer element) { constructDefault(element); });
+  }
 
-    size_ = count;
+  // appends count default-initialized elements and returns the first of them
+  // to be filled in place; grows by the growth policy, unlike Resize
+  pointer Append_uninitialized(size_type count) {
+    const size_type old_size = size_;
+    const size_type new_size = size_ + count;
+    if (new_size > capacity_)
+      reallocate(calculate_capacity(capacity_, new_size));
+    for (; size_ < new_size; ++size_) constructDefault(data_ + size_);
+    return data_ + old_size;
   }
 
   template <typename... Args>
@@ -644,122 +945,122 @@ class Vector {
     size_type new_size = size_ + 1ull;
 
     if (new_size > capacity_) {
-      size_type new_capacity = calculate_capacity(new_size);
+      size_type new_capacity = calculate_capacity(capacity_, new_size);
       reallocate(new_capacity);
     }
     // data_[old_size] = value_type(std::forward<Args>(args)...);
-    new (data_ + old_size) value_type(std::forward<Args>(args)...);
+    traits::construct(this->allocator(), data_ + old_size,
+                      std::forward<Args>(args)...);
     size_ = new_size;
   }
 
   constexpr void Swap(Vector& other) {
     using namespace std;  // to enable ADL
+    if constexpr (traits::propagate_on_container_swap::value)
+      swap(this->allocator(), other.allocator());
+    else
+      assert(this->allocator() == other.allocator() &&
+             "Swapping vectors with unequal allocators!");
     swap(data_, other.data_);
     swap(size_, other.size_);
     swap(capacity_, other.capacity_);
   }
 
  private:
-  static size_type calculate_capacity(size_type count) {
-    size_type result = 1ull;
-    while (result <= count) result <<= 1ull;
-    return result - 1ull;
+  static size_type calculate_capacity(size_type capacity,
+                                      size_type count) noexcept {
+    return GrowthPolicy::Next(capacity, count, sizeof(value_type));
   }
   void allocate(size_type exact_count) {
     assert(!data_ && "Possible memory leak!");
 
-    char* preallocated_buffer =
-        new char[sizeof(value_type) *
-                 exact_count];  // no constructors were called
-    data_ = reinterpret_cast<pointer>(preallocated_buffer);
+    // no constructors were called
+    if (exact_count) data_ = traits::allocate(this->allocator(), exact_count);
     capacity_ = exact_count;
   }
   void reallocate(size_type exact_count) {
-    char* preallocated_buffer =
-        new char[sizeof(value_type) *
-                 exact_count];  // no constructors were called
-    size_type new_size = size_;
-    pointer new_data = reinterpret_cast<pointer>(preallocated_buffer);
+    // bytes of trivially copyable elements may stay where they are while the
+    // allocator resizes the chunk
+    if constexpr (Utility::CanReallocate<Allocator>::value &&
+                  std::is_trivially_copyable_v<value_type>) {
+      if (data_ && exact_count) {
+        pointer new_data =
+            this->allocator().reallocate(data_, capacity_, exact_count);
+        if (new_data) {
+          data_ = new_data;
+          capacity_ = exact_count;
+          return;
+        }
+      }
+    }
 
-    for (size_type i = 0ull; i < size_; ++i)
-      new (new_data + i) value_type(data_[i]);
+    // no constructors were called
+    pointer new_data =
+        exact_count ? traits::allocate(this->allocator(), exact_count)
+                    : nullptr;
+
+    try {
+      Utility::Relocate(this->allocator(), data_, size_, new_data);
+    } catch (...) {
+      if (new_data)
+        traits::deallocate(this->allocator(), new_data, exact_count);
+      throw;
+    }
 
-    deallocate();
+    adopt(new_data, exact_count);
+  }
+  // takes new_data of new_capacity elements instead of the memory it had
+  void adopt(pointer new_data, size_type new_capacity) noexcept {
+    if (data_) traits::deallocate(this->allocator(), data_, capacity_);
     data_ = new_data;
-    size_ = new_size;
-    capacity_ = exact_count;
+    capacity_ = new_capacity;
+  }
+  void assignInPlace(const Vector& other) {
+    if (other.size_ <= size_) {
+      std::copy(other.data_, other.data_ + other.size_, data_);
+      for (size_type i = other.size_; i < size_; ++i)
+        traits::destroy(this->allocator(), data_ + i);
+      size_ = other.size_;
+      return;
+    }
+
+    std::copy(other.data_, other.data_ + size_, data_);
+    Utility::CopyConstruct(this->allocator(), other.data_ + size_,
+                           other.size_ - size_, data_ + size_);
+    size_ = other.size_;
   }
   void deallocate() noexcept {
-    for (size_type i = 0ull; i < size_; ++i) (data_ + i)->~value_type();
-    delete[] reinterpret_cast<char*>(data_);
+    for (size_type i = 0ull; i < size_; ++i)
+      traits::destroy(this->allocator(), data_ + i);
+    if (data_) traits::deallocate(this->allocator(), data_, capacity_);
     data_ = nullptr;
     capacity_ = 0ull;
     size_ = 0ull;
   }
+  // other is left empty, the allocators should be equal
+  void steal(Vector& other) noexcept {
+    data_ = other.data_;
+    size_ = other.size_;
+    capacity_ = other.capacity_;
 
-  void checkReallocateUpdatingIterator(size_type new_size,
-                                       const_iterator& pos) {
-    if (new_size > capacity_) {
-      const size_type pos_index = pos - cbegin();
-      reallocate(calculate_capacity(new_size));
-      pos = cbegin() + pos_index;
-    }
-  }
-  iterator shiftBack(size_type shift, const_iterator pos_untill) {
-    assert(size_ + shift <= capacity_ && "Shifting is out of range!");
-    if (!shift) return static_cast<iterator>(pos_untill);
-    size_type new_size = size_ + shift;
-    auto it = end() - 1ull;
-    while (it >= pos_untill) {
-      new ((it + shift).operator->()) value_type(*it);
-      it->~value_type();
-      --it;
-    }
-    ++it;
-    size_ = new_size;
-    return it;
-  }
-  iterator shiftForward(size_type shift, const_iterator pos_untill) {
-    iterator it(static_cast<iterator>(pos_untill));
-    if (!shift) return it;
-    it -= shift;
-    const iterator result = it;
-    while (it < end() - shift) {
-      *it = *(it + shift);
-      ++it;
-    }
-    while (it < end()) {
-      it->~value_type();
-      ++it;
-    }
-    size_ -= shift;
-    return result;
+    other.data_ = nullptr;
+    other.size_ = 0ull;
+    other.capacity_ = 0ull;
   }
 
-  template <typename Last>
-  void insert_many_back(Last&& last) {
-    Push_back(std::forward<Last>(last));
-  }
-  template <typename First, class... Args>
-  void insert_many_back(First&& first, Args&&... args) {
-    Push_back(std::forward<First>(first));
-    insert_many_back(std::forward<Args>(args)...);
+  void constructDefault(pointer element) {
+    if constexpr (std::is_trivially_default_constructible_v<value_type>)
+      ::new (static_cast<void*>(element)) value_type;
+    else
+      traits::construct(this->allocator(), element);
   }
 
-  template <typename Last>
-  iterator insert_many(const_iterator pos, Last&& last) {
-    return Insert(pos, std::forward<Last>(last));
-  }
-  template <typename First, class... Args>
-  iterator insert_many(const_iterator pos, First&& first, Args&&... args) {
-    iterator it = insert_many(pos, std::forward<Args>(args)...);
-    return Insert(static_cast<const_iterator>(it), std::forward<First>(first));
-  }
   template <class InputIt>
   static size_type getDistance(InputIt first, InputIt last) noexcept {
     size_type count = 0ull;
-    if constexpr (std::is_same_v<typename InputIt::iterator_category,
-                                 std::random_access_iterator_tag>) {
+    if constexpr (std::is_same_v<
+                      typename std::iterator_traits<InputIt>::iterator_category,
+                      std::random_access_iterator_tag>) {
       count = last - first;
     } else {
       while (first != last) {
@@ -771,27 +1072,29 @@ class Vector {
   }
 };
 
-template <typename Type>
-bool operator==(const Vector<Type>& left, const Vector<Type>& right) {
-  if (left.Size() != right.Size()) return false;
-
-  auto left_iterator = left.cbegin();
-  auto right_iterator = right.cbegin();
-
-  while (left_iterator != left.cend()) {
-    if (*left_iterator != *right_iterator) return false;
-    ++left_iterator;
-    ++right_iterator;
-  }
-
-  return true;
+template <typename Type, typename GrowthPolicy, typename Allocator>
+bool operator==(const Vector<Type, GrowthPolicy, Allocator>& left,
+                const Vector<Type, GrowthPolicy, Allocator>& right) {
+  return VectorDetail::Equal(left, right);
 }
 
-template <typename Type>
-bool operator!=(const Vector<Type>& left, const Vector<Type>& right) {
+template <typename Type, typename GrowthPolicy, typename Allocator>
+bool operator!=(const Vector<Type, GrowthPolicy, Allocator>& left,
+                const Vector<Type, GrowthPolicy, Allocator>& right) {
   return !(left == right);
 }
 
+namespace pmr {
+
+template <typename Type, typename GrowthPolicy = Growth::PowerOfTwo>
+using Vector =
+    s21::Vector<Type, GrowthPolicy, std::pmr::polymorphic_allocator<Type>>;
+
+}  // namespace pmr
+
 }  // namespace s21
 
+#include "s21_bitset.h"  // Vector<bool>
+#include "s21_span.h"    // Span
+
 #endif  //  _S21_VECTOR_H_
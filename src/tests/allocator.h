@@ -0,0 +1,77 @@
+#ifndef _TESTS_ALLOCATOR_H_
+#define _TESTS_ALLOCATOR_H_
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+// GCOVR_EXCL_START
+
+// What the allocators sharing the statistics have done
+struct AllocationStatistics {
+  std::size_t allocations = 0ull;
+  std::size_t deallocations = 0ull;
+  std::size_t allocated = 0ull;  // elements which are not deallocated yet
+};
+
+// Allocator which counts its allocations. The copies count into the same
+// statistics and are equal, the ones with different statistics are not:
+// the memory allocated by one of them should not be freed by another.
+// Propagate sets all three propagation traits
+template <typename Type, bool Propagate = false>
+class CountingAllocator {
+ public:
+  using value_type = Type;
+  using propagate_on_container_copy_assignment =
+      std::bool_constant<Propagate>;
+  using propagate_on_container_move_assignment =
+      std::bool_constant<Propagate>;
+  using propagate_on_container_swap = std::bool_constant<Propagate>;
+  using is_always_equal = std::false_type;
+
+  template <typename Other>
+  struct rebind {
+    using other = CountingAllocator<Other, Propagate>;
+  };
+
+ private:
+  AllocationStatistics* statistics_;
+
+ public:
+  CountingAllocator() noexcept : statistics_{nullptr} {}
+  explicit CountingAllocator(AllocationStatistics* statistics) noexcept
+      : statistics_{statistics} {}
+  template <typename Other>
+  CountingAllocator(const CountingAllocator<Other, Propagate>& other) noexcept
+      : statistics_{other.Statistics()} {}
+
+  Type* allocate(std::size_t count) {
+    if (statistics_) {
+      ++statistics_->allocations;
+      statistics_->allocated += count;
+    }
+    return std::allocator<Type>().allocate(count);
+  }
+  void deallocate(Type* pointer, std::size_t count) noexcept {
+    if (statistics_) {
+      ++statistics_->deallocations;
+      statistics_->allocated -= count;
+    }
+    std::allocator<Type>().deallocate(pointer, count);
+  }
+
+  AllocationStatistics* Statistics() const noexcept { return statistics_; }
+
+  template <typename Other>
+  bool operator==(const CountingAllocator<Other, Propagate>& other) const {
+    return statistics_ == other.Statistics();
+  }
+  template <typename Other>
+  bool operator!=(const CountingAllocator<Other, Propagate>& other) const {
+    return !(*this == other);
+  }
+};
+
+// GCOVR_EXCL_STOP
+
+#endif  //  _TESTS_ALLOCATOR_H_
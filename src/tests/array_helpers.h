@@ -8,8 +8,8 @@
 
 // GCOVR_EXCL_START
 
-template <typename Type, std::size_t N>
-bool operator==(const s21::Array<Type, N>& s21_array,
+template <typename Type, std::size_t N, std::size_t Alignment>
+bool operator==(const s21::Array<Type, N, Alignment>& s21_array,
                 const std::array<Type, N>& array) {
   if (s21_array.Size() != array.size()) return false;
 
@@ -24,26 +24,27 @@ bool operator==(const s21::Array<Type, N>& s21_array,
   return true;
 }
 
-template <typename Type, std::size_t N>
+template <typename Type, std::size_t N, std::size_t Alignment>
 bool operator==(const std::array<Type, N>& array,
-                const s21::Array<Type, N>& s21_array) {
+                const s21::Array<Type, N, Alignment>& s21_array) {
   return s21_array == array;
 }
 
-template <typename Type, std::size_t N>
-bool operator!=(const s21::Array<Type, N>& s21_array,
+template <typename Type, std::size_t N, std::size_t Alignment>
+bool operator!=(const s21::Array<Type, N, Alignment>& s21_array,
                 const std::array<Type, N>& array) {
   return !(s21_array == array);
 }
 
-template <typename Type, std::size_t N>
+template <typename Type, std::size_t N, std::size_t Alignment>
 bool operator!=(const std::array<Type, N>& array,
-                const s21::Array<Type, N>& s21_array) {
+                const s21::Array<Type, N, Alignment>& s21_array) {
   return !(s21_array == array);
 }
 
-template <typename Type, std::size_t N>
-std::ostream& operator<<(std::ostream& out, const s21::Array<Type, N>& object) {
+template <typename Type, std::size_t N, std::size_t Alignment>
+std::ostream& operator<<(std::ostream& out,
+                         const s21::Array<Type, N, Alignment>& object) {
   out << "Array: ";
   for (const auto& element : object) out << element << ' ';
   return out;
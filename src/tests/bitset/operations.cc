@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+
+#include <bitset>
+#include <vector>
+
+#include "../../s21_bitset.h"
+
+// GCOVR_EXCL_START
+
+namespace {
+
+using Bitset = s21::DynamicBitset<>;
+
+TEST(DynamicBitset, T0Constructors) {
+  const Bitset empty;
+  const Bitset zeros(100ull);
+  const Bitset ones(100ull, true);
+  const Bitset list{true, false, true};
+
+  EXPECT_TRUE(empty.Empty());
+  EXPECT_TRUE(zeros.None());
+  EXPECT_TRUE(ones.All());
+  EXPECT_EQ(ones.Count(), 100ull);
+  EXPECT_EQ(ones.Word_count(), 2ull);
+  EXPECT_EQ(list.Count(), 2ull);
+  EXPECT_TRUE(list.Test(2ull));
+  EXPECT_THROW(list.Test(3ull), std::out_of_range);
+}
+
+TEST(DynamicBitset, T0SetResetFlip) {
+  Bitset bits(130ull);
+  bits.Set(0ull).Set(64ull).Set(129ull).Flip(1ull).Reset(0ull);
+
+  EXPECT_EQ(bits.Count(), 3ull);
+  EXPECT_FALSE(bits[0]);
+  EXPECT_TRUE(bits[1]);
+
+  bits.Flip();
+  EXPECT_EQ(bits.Count(), 127ull);  // the tail of the last word stays zero
+  bits.Set();
+  EXPECT_TRUE(bits.All());
+  bits.Reset();
+  EXPECT_TRUE(bits.None());
+}
+
+TEST(DynamicBitset, T0FindFirstNext) {
+  Bitset bits(1000ull);
+  const std::vector<std::size_t> positions{3ull, 63ull, 64ull, 500ull, 999ull};
+  for (std::size_t pos : positions) bits.Set(pos);
+
+  std::vector<std::size_t> found;
+  for (std::size_t pos = bits.Find_first(); pos != Bitset::npos;
+       pos = bits.Find_next(pos))
+    found.push_back(pos);
+
+  EXPECT_TRUE(found == positions);
+  EXPECT_EQ(Bitset(10ull).Find_first(), Bitset::npos);
+  EXPECT_EQ(Bitset().Find_first(), Bitset::npos);
+}
+
+TEST(DynamicBitset, T0LogicalOperations) {
+  constexpr std::size_t kSize = 200ull;
+  Bitset left(kSize);
+  Bitset right(kSize);
+  std::bitset<kSize> std_left;
+  std::bitset<kSize> std_right;
+  for (std::size_t i = 0ull; i < kSize; ++i) {
+    left.Set(i, i % 3 == 0);
+    std_left.set(i, i % 3 == 0);
+    right.Set(i, i % 5 == 0);
+    std_right.set(i, i % 5 == 0);
+  }
+
+  auto equal = [](const Bitset& bits, const std::bitset<kSize>& std_bits) {
+    for (std::size_t i = 0ull; i < kSize; ++i)
+      if (bits[i] != std_bits[i]) return false;
+    return bits.Count() == std_bits.count();
+  };
+  EXPECT_TRUE(equal(left & right, std_left & std_right));
+  EXPECT_TRUE(equal(left | right, std_left | std_right));
+  EXPECT_TRUE(equal(left ^ right, std_left ^ std_right));
+  EXPECT_TRUE(equal(~left, ~std_left));
+
+  Bitset difference(left);
+  difference.And_not(right);
+  EXPECT_TRUE(equal(difference, std_left & ~std_right));
+  EXPECT_TRUE(difference != left);
+}
+
+TEST(DynamicBitset, T0PushBackResize) {
+  Bitset bits;
+  for (int i = 0; i < 100; ++i) bits.Push_back(i % 2 == 1);
+  EXPECT_EQ(bits.Size(), 100ull);
+  EXPECT_EQ(bits.Count(), 50ull);
+
+  bits.Pop_back();
+  bits.Resize(150ull, true);
+  EXPECT_EQ(bits.Count(), 49ull + 51ull);
+
+  bits.Resize(65ull);
+  EXPECT_EQ(bits.Word_count(), 2ull);
+  EXPECT_EQ(bits.Count(), 32ull);
+
+  Bitset other(3ull, true);
+  bits.Swap(other);
+  EXPECT_EQ(bits.Size(), 3ull);
+  EXPECT_TRUE(other == other);
+  bits.Clear();
+  EXPECT_TRUE(bits.Empty());
+}
+
+}  // namespace
+
+// GCOVR_EXCL_STOP
@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "../../s21_compressed_vector.h"
+#include "../../s21_vector.h"
+
+// GCOVR_EXCL_START
+
+namespace {
+
+using Plain = s21::CompressedVector<>;
+using Sorted = s21::CompressedVector<s21::Codec::Delta>;
+
+// the widths of the residuals differ from block to block
+std::vector<std::uint32_t> make_values(std::size_t size, bool sorted) {
+  std::mt19937 generator(42u);
+  std::vector<std::uint32_t> result(size);
+  for (std::size_t i = 0ull; i < size; ++i) {
+    const std::uint32_t bits = static_cast<std::uint32_t>(i / 128ull % 33ull);
+    const std::uint32_t mask = bits == 32u ? ~0u : (1u << bits) - 1u;
+    result[i] = 1000u + (generator() & mask);
+  }
+  if (sorted) {
+    for (auto& value : result) value %= 1u << 16;
+    std::partial_sum(result.begin(), result.end(), result.begin());
+  }
+  return result;
+}
+
+template <typename Compressed>
+void expect_equal(const Compressed& compressed,
+                  const std::vector<std::uint32_t>& expected) {
+  ASSERT_EQ(compressed.Size(), expected.size());
+  for (std::size_t i = 0ull; i < expected.size(); ++i)
+    ASSERT_EQ(compressed[i], expected[i]) << i;
+  ASSERT_TRUE(std::equal(compressed.begin(), compressed.end(),
+                         expected.begin(), expected.end()));
+  const s21::Vector<std::uint32_t> decompressed = compressed.Decompress();
+  ASSERT_TRUE(std::equal(decompressed.begin(), decompressed.end(),
+                         expected.begin(), expected.end()));
+}
+
+TEST(CompressedVector, T0FrameOfReference) {
+  for (std::size_t size : {0ull, 1ull, 127ull, 128ull, 129ull, 5000ull}) {
+    const std::vector<std::uint32_t> values = make_values(size, false);
+    Plain compressed(values.begin(), values.end());
+    expect_equal(compressed, values);
+  }
+}
+
+TEST(CompressedVector, T1Delta) {
+  for (std::size_t size : {0ull, 1ull, 128ull, 300ull, 5000ull}) {
+    const std::vector<std::uint32_t> values = make_values(size, true);
+    Sorted compressed;
+    for (std::uint32_t value : values) compressed.Push_back(value);
+    expect_equal(compressed, values);
+  }
+}
+
+TEST(CompressedVector, T2Memory) {
+  s21::Vector<std::uint32_t> postings;
+  for (std::uint32_t i = 0u; i < 128000u; ++i) postings.Push_back(i * 3u + 7u);
+  Sorted sorted(postings);
+  Plain plain(postings);
+  // deltas of 3 take 2 bits, the ranges of 381 in a block 9 bits
+  EXPECT_LT(sorted.Memory() * 8ull, postings.Size() * 4ull);
+  EXPECT_LT(plain.Memory() * 3ull, postings.Size() * 4ull);
+  EXPECT_EQ(sorted.Front(), 7u);
+  EXPECT_EQ(sorted.Back(), postings.Back());
+  EXPECT_EQ(plain.At(1000ull), postings[1000ull]);
+
+  Plain zeros(s21::Vector<std::uint32_t>(1024ull, 5u));
+  EXPECT_EQ(zeros[1023ull], 5u);
+  EXPECT_LT(zeros.Memory(), 1024ull);
+}
+
+TEST(CompressedVector, T3Other) {
+  Plain compressed{5u, 1u, 4u};
+  EXPECT_EQ(compressed.Size(), 3ull);
+  EXPECT_EQ(compressed.Back(), 4u);
+  EXPECT_THROW(compressed.At(3ull), std::out_of_range);
+  EXPECT_EQ(compressed, (Plain{5u, 1u, 4u}));
+
+  Plain other;
+  EXPECT_TRUE(other.Empty());
+  EXPECT_EQ(other.begin(), other.end());
+  other.Swap(compressed);
+  EXPECT_EQ(other.Size(), 3ull);
+  EXPECT_TRUE(compressed.Empty());
+  EXPECT_NE(other, compressed);
+  other.Clear();
+  EXPECT_EQ(other, compressed);
+}
+
+TEST(CompressedVector, T4ShrinkToFit) {
+  Sorted sorted;
+  sorted.Reserve(12800ull);
+  for (std::uint32_t i = 0u; i < 12850u; ++i) sorted.Push_back(i);
+  const std::size_t grown = sorted.Memory();
+
+  sorted.Shrink_to_fit();
+  // 100 blocks of deltas of 1 in 2 words each, their skip table and the tail
+  EXPECT_LT(sorted.Memory(), grown);
+  EXPECT_EQ(sorted.Memory(), 200ull * 8ull + 100ull * 16ull + 50ull * 4ull);
+  EXPECT_EQ(sorted.Back(), 12849u);
+}
+
+}  // namespace
+
+// GCOVR_EXCL_STOP
@@ -0,0 +1,179 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "../../s21_concurrent_vector.h"
+#include "../allocator.h"
+#include "../item.h"
+
+// GCOVR_EXCL_START
+
+namespace {
+
+TEST(ConcurrentVector, T0PushBack) {
+  s21::ConcurrentVector<Item, 2> s21_vector;
+  std::vector<Item> vector;
+  for (int i = 0; i < 100; ++i) {
+    s21_vector.Push_back(Item(i));
+    vector.push_back(Item(i));
+  }
+
+  EXPECT_EQ(s21_vector.Size(), vector.size());
+  EXPECT_TRUE(std::equal(s21_vector.cbegin(), s21_vector.cend(),
+                         vector.cbegin(), vector.cend()));
+  EXPECT_EQ(s21_vector.At(99ull), Item(99));
+  EXPECT_THROW(s21_vector.At(100ull), std::out_of_range);
+  EXPECT_FALSE(s21_vector.Ready(100ull));
+}
+
+TEST(ConcurrentVector, T0CopyMove) {
+  const s21::ConcurrentVector<Item> s21_vector{Item(1), Item(2), Item(3)};
+
+  s21::ConcurrentVector<Item> s21_copy(s21_vector);
+  EXPECT_TRUE(s21_copy == s21_vector);
+
+  const Item* const address = &s21_copy[1];
+  s21::ConcurrentVector<Item> s21_moved(std::move(s21_copy));
+  EXPECT_TRUE(s21_moved == s21_vector);
+  EXPECT_EQ(&s21_moved[1], address);
+  EXPECT_TRUE(s21_copy.Empty());
+
+  s21_copy = s21_vector;
+  s21_moved = std::move(s21_copy);
+  s21_moved.Push_back(Item(4));
+  EXPECT_TRUE(s21_moved != s21_vector);
+  EXPECT_EQ(s21_moved.Size(), 4ull);
+}
+
+// negative numbers can not be constructed: their slots never get Ready
+class Positive {
+ public:
+  explicit Positive(int number) : number_{number} {
+    if (number < 0) throw std::invalid_argument("Negative number!");
+  }
+
+  bool operator!=(const Positive& other) const {
+    return number_ != other.number_;
+  }
+
+ private:
+  int number_;
+};
+
+TEST(ConcurrentVector, T0CopyStopsAtSlotNotReady) {
+  s21::ConcurrentVector<Positive> s21_vector;
+  s21_vector.Emplace_back(1);
+  s21_vector.Emplace_back(2);
+  EXPECT_THROW(s21_vector.Emplace_back(-1), std::invalid_argument);
+  s21_vector.Emplace_back(3);
+
+  EXPECT_EQ(s21_vector.Size(), 4ull);
+  EXPECT_FALSE(s21_vector.Ready(2ull));
+  EXPECT_TRUE(s21_vector.Ready(3ull));
+
+  const s21::ConcurrentVector<Positive> s21_copy(s21_vector);
+  EXPECT_EQ(s21_copy.Size(), 2ull);
+  EXPECT_TRUE(s21_copy == s21_vector);
+
+  s21::ConcurrentVector<Positive> s21_longer(s21_copy);
+  s21_longer.Emplace_back(3);
+  EXPECT_TRUE(s21_longer != s21_vector);
+}
+
+TEST(ConcurrentVector, T0Allocator) {
+  AllocationStatistics statistics;
+  {
+    s21::ConcurrentVector<Item, 16, CountingAllocator<Item>> s21_vector{
+        CountingAllocator<Item>(&statistics)};
+    s21_vector.Reserve(100ull);
+    // 16 + 32 + 64, each with its bitmap
+    EXPECT_EQ(statistics.allocations, 6ull);
+
+    for (int i = 0; i < 1000; ++i) s21_vector.Push_back(Item(i));
+    EXPECT_EQ(statistics.allocations, 12ull);  // ... + 512
+  }
+  EXPECT_EQ(statistics.deallocations, statistics.allocations);
+  EXPECT_EQ(statistics.allocated, 0ull);
+}
+
+TEST(ConcurrentVector, T0ManyWriters) {
+  constexpr std::size_t kThreads = 8ull;
+  constexpr std::size_t kCount = 20000ull;
+  s21::ConcurrentVector<std::size_t, 4> s21_vector;
+
+  std::vector<std::thread> writers;
+  for (std::size_t t = 0ull; t < kThreads; ++t)
+    writers.emplace_back([&s21_vector, t] {
+      for (std::size_t i = 0ull; i < kCount; ++i)
+        s21_vector.Push_back(t * kCount + i);
+    });
+  for (auto& writer : writers) writer.join();
+
+  std::vector<std::size_t> values(s21_vector.cbegin(), s21_vector.cend());
+  std::sort(values.begin(), values.end());
+  ASSERT_EQ(values.size(), kThreads * kCount);
+  for (std::size_t i = 0ull; i < values.size(); ++i) EXPECT_EQ(values[i], i);
+}
+
+TEST(ConcurrentVector, T0ManyWritersAllocateOnce) {
+  constexpr std::size_t kThreads = 8ull;
+  constexpr std::size_t kCount = 1000ull;
+  AllocationStatistics statistics;
+  {
+    s21::ConcurrentVector<int, 1, CountingAllocator<int>> s21_vector{
+        CountingAllocator<int>(&statistics)};
+
+    // the writers race for every new block, only one of them allocates it
+    std::vector<std::thread> writers;
+    for (std::size_t t = 0ull; t < kThreads; ++t)
+      writers.emplace_back([&s21_vector] {
+        for (std::size_t i = 0ull; i < kCount; ++i) s21_vector.Push_back(1);
+      });
+    for (auto& writer : writers) writer.join();
+
+    EXPECT_EQ(s21_vector.Size(), kThreads * kCount);
+    EXPECT_EQ(statistics.allocations, 2ull * 13ull);  // 1 + 2 + ... + 4096
+  }
+  EXPECT_EQ(statistics.deallocations, statistics.allocations);
+  EXPECT_EQ(statistics.allocated, 0ull);
+}
+
+TEST(ConcurrentVector, T0ReadersWhileWriting) {
+  constexpr std::size_t kThreads = 4ull;
+  constexpr std::size_t kCount = 20000ull;
+  s21::ConcurrentVector<Item, 4> s21_vector;
+  std::atomic<bool> done{false};
+  std::atomic<std::size_t> mismatches{0ull};
+
+  // a Ready element is seen whole, whichever writer has made it
+  std::thread reader([&] {
+    while (!done.load(std::memory_order_acquire)) {
+      const std::size_t size = s21_vector.Size();
+      for (std::size_t i = 0ull; i < size; ++i)
+        if (s21_vector.Ready(i) && s21_vector[i].empty()) ++mismatches;
+    }
+  });
+
+  std::vector<std::thread> writers;
+  for (std::size_t t = 0ull; t < kThreads; ++t)
+    writers.emplace_back([&s21_vector] {
+      for (std::size_t i = 0ull; i < kCount; ++i)
+        s21_vector.Emplace_back(static_cast<int>(i), 'b', 1.5);
+    });
+  for (auto& writer : writers) writer.join();
+  done.store(true, std::memory_order_release);
+  reader.join();
+
+  EXPECT_EQ(mismatches.load(), 0ull);
+  EXPECT_EQ(s21_vector.Size(), kThreads * kCount);
+  for (std::size_t i = 0ull; i < s21_vector.Size(); ++i)
+    EXPECT_TRUE(s21_vector.Ready(i));
+}
+
+}  // namespace
+
+// GCOVR_EXCL_STOP
@@ -0,0 +1,54 @@
+#ifndef _TESTS_COUNTER_H_
+#define _TESTS_COUNTER_H_
+
+#include <cstddef>
+#include <iostream>
+
+// GCOVR_EXCL_START
+
+// Value which counts how many times values of its type were copied and moved,
+// to check that containers do not make needless copies
+class Counter {
+ public:
+  inline static std::size_t constructions = 0ull;
+  inline static std::size_t copies = 0ull;
+  inline static std::size_t moves = 0ull;
+
+ private:
+  int number_;
+
+ public:
+  explicit Counter(int number = 0) : number_{number} { ++constructions; }
+  Counter(int first, int second) : number_{first + second} { ++constructions; }
+  Counter(const Counter& other) : number_{other.number_} { ++copies; }
+  Counter(Counter&& other) noexcept : number_{other.number_} { ++moves; }
+
+  Counter& operator=(const Counter& other) {
+    number_ = other.number_;
+    ++copies;
+    return *this;
+  }
+  Counter& operator=(Counter&& other) noexcept {
+    number_ = other.number_;
+    ++moves;
+    return *this;
+  }
+
+  static void Reset() noexcept { constructions = copies = moves = 0ull; }
+
+  int number() const noexcept { return number_; }
+
+  bool operator==(const Counter& right) const {
+    return number_ == right.number_;
+  }
+  bool operator!=(const Counter& right) const { return !(*this == right); }
+  bool operator<(const Counter& right) const { return number_ < right.number_; }
+
+  friend std::ostream& operator<<(std::ostream& out, const Counter& object) {
+    return out << object.number_;
+  }
+};
+
+// GCOVR_EXCL_STOP
+
+#endif  //  _TESTS_COUNTER_H_
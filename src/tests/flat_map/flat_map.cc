@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../../s21_flat_map.h"
+#include "../../s21_vector.h"
+
+// GCOVR_EXCL_START
+
+namespace {
+
+template <typename Key, typename Value>
+bool operator==(const s21::FlatMap<Key, Value>& flat,
+                const std::map<Key, Value>& map) {
+  if (flat.Size() != map.size()) return false;
+  auto it = map.begin();
+  for (const auto& [key, value] : flat) {
+    if (key != it->first || value != it->second) return false;
+    ++it;
+  }
+  return true;
+}
+
+TEST(FlatMap, T0Constructors) {
+  s21::FlatMap<int, std::string> empty;
+  EXPECT_TRUE(empty.Empty());
+  EXPECT_EQ(empty.begin(), empty.end());
+
+  // the first of equal keys is kept, as std::map does
+  s21::FlatMap<int, std::string> list{{3, "c"}, {1, "a"}, {3, "x"}, {2, "b"}};
+  EXPECT_TRUE(list == (std::map<int, std::string>{
+                          {3, "c"}, {1, "a"}, {3, "x"}, {2, "b"}}));
+  EXPECT_EQ(list.Keys(), (s21::Vector<int>{1, 2, 3}));
+  EXPECT_EQ(list.Values(), (s21::Vector<std::string>{"a", "b", "c"}));
+
+  std::map<std::string, int> source{{"one", 1}, {"two", 2}};
+  s21::FlatMap<std::string, int> range(source.begin(), source.end());
+  EXPECT_TRUE(range == source);
+}
+
+TEST(FlatMap, T1Access) {
+  s21::FlatMap<std::string, int> flat;
+  flat["b"] = 2;
+  flat["a"] = 1;
+  ++flat["b"];
+  const std::string key = "c";
+  flat[key] += 5;
+  EXPECT_EQ(flat.At("a"), 1);
+  EXPECT_EQ(flat.At("b"), 3);
+  EXPECT_EQ(flat.At("c"), 5);
+  EXPECT_THROW(flat.At("d"), std::out_of_range);
+  const auto& constant = flat;
+  EXPECT_EQ(constant.At("b"), 3);
+  EXPECT_THROW(constant.At("d"), std::out_of_range);
+}
+
+TEST(FlatMap, T2InsertErase) {
+  s21::FlatMap<int, int> flat;
+  std::map<int, int> map;
+  std::mt19937 generator(42u);
+  for (int i = 0; i < 2000; ++i) {
+    const int key = static_cast<int>(generator() % 500u);
+    if (i % 3 == 2) {
+      EXPECT_EQ(flat.Erase(key), map.erase(key));
+    } else {
+      const auto [it, inserted] = flat.Insert({key, i});
+      EXPECT_EQ(inserted, map.insert({key, i}).second);
+      EXPECT_EQ(it->first, key);
+      EXPECT_EQ(it->second, map[key]);
+    }
+  }
+  EXPECT_TRUE(flat == map);
+
+  auto [it, inserted] = flat.Insert_or_assign(map.begin()->first, -1);
+  EXPECT_FALSE(inserted);
+  EXPECT_EQ(it->second, -1);
+  map.begin()->second = -1;
+  EXPECT_TRUE(flat == map);
+
+  auto next = flat.Erase(flat.cbegin() + 1, flat.cbegin() + 3);
+  map.erase(std::next(map.begin()), std::next(map.begin(), 3));
+  EXPECT_EQ(next->first, std::next(map.begin())->first);
+  EXPECT_TRUE(flat == map);
+}
+
+TEST(FlatMap, T3Lookup) {
+  s21::FlatMap<int, char> flat{{10, 'a'}, {20, 'b'}, {30, 'c'}};
+  EXPECT_EQ(flat.Find(20)->second, 'b');
+  EXPECT_EQ(flat.Find(25), flat.end());
+  EXPECT_TRUE(flat.Contains(30));
+  EXPECT_EQ(flat.Count(40), 0ull);
+  EXPECT_EQ(flat.Lower_bound(15)->first, 20);
+  EXPECT_EQ(flat.Upper_bound(20)->first, 30);
+  const auto [first, last] = flat.Equal_range(20);
+  EXPECT_EQ(last - first, 1);
+
+  flat.Find(10)->second = 'z';
+  const auto& constant = flat;
+  s21::FlatMap<int, char>::const_iterator it = constant.Find(10);
+  EXPECT_EQ((*it).second, 'z');
+  EXPECT_EQ(it, flat.begin());
+  EXPECT_EQ(constant.Lower_bound(5), constant.begin());
+}
+
+TEST(FlatMap, T4InsertRange) {
+  std::mt19937 generator(3u);
+  std::vector<std::pair<int, int>> first, second;
+  for (int i = 0; i < 3000; ++i)
+    first.emplace_back(generator() % 5000u, i);
+  for (int i = 0; i < 3000; ++i)
+    second.emplace_back(generator() % 5000u, -i);
+
+  s21::FlatMap<int, int> flat(first.begin(), first.end());
+  flat.Insert(second.begin(), second.end());
+  std::map<int, int> map(first.begin(), first.end());
+  map.insert(second.begin(), second.end());
+  EXPECT_TRUE(flat == map);
+
+  s21::FlatMap<int, int> copy = flat;
+  copy.Insert({{-5, 5}, {0, 0}});
+  map.insert({{-5, 5}, {0, 0}});
+  EXPECT_TRUE(copy == map);
+  EXPECT_NE(copy, flat);
+  copy.Swap(flat);
+  EXPECT_TRUE(flat == map);
+  flat.Clear();
+  EXPECT_TRUE(flat.Empty());
+}
+
+}  // namespace
+
+// GCOVR_EXCL_STOP
@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "../../s21_flat_map.h"
+#include "../../s21_vector.h"
+
+// GCOVR_EXCL_START
+
+namespace {
+
+template <typename Key, typename FlatComparator, typename Comparator>
+bool operator==(const s21::FlatSet<Key, FlatComparator>& flat,
+                const std::set<Key, Comparator>& set) {
+  return flat.Size() == set.size() &&
+         std::equal(flat.begin(), flat.end(), set.begin());
+}
+
+TEST(FlatSet, T0Constructors) {
+  s21::FlatSet<int> empty;
+  EXPECT_TRUE(empty.Empty());
+  EXPECT_EQ(empty.begin(), empty.end());
+
+  s21::FlatSet<int> list{5, 1, 4, 1, 5, 9, 2, 6};
+  EXPECT_TRUE(list == (std::set<int>{5, 1, 4, 1, 5, 9, 2, 6}));
+
+  std::vector<std::string> words{"b", "a", "c", "a"};
+  s21::FlatSet<std::string, std::greater<std::string>> range(words.begin(),
+                                                             words.end());
+  EXPECT_TRUE(range == (std::set<std::string, std::greater<std::string>>(
+                           words.begin(), words.end())));
+
+  s21::FlatSet<int> moved(s21::Vector<int>{3, 3, 2, 1});
+  EXPECT_EQ(moved.Keys(), (s21::Vector<int>{1, 2, 3}));
+}
+
+TEST(FlatSet, T1InsertErase) {
+  s21::FlatSet<int> flat;
+  std::set<int> set;
+  std::mt19937 generator(42u);
+  for (int i = 0; i < 2000; ++i) {
+    const int key = static_cast<int>(generator() % 500u);
+    if (i % 3 == 2) {
+      EXPECT_EQ(flat.Erase(key), set.erase(key));
+    } else {
+      const auto [it, inserted] = flat.Insert(key);
+      EXPECT_EQ(inserted, set.insert(key).second);
+      EXPECT_EQ(*it, key);
+    }
+  }
+  EXPECT_TRUE(flat == set);
+
+  auto it = flat.Erase(flat.begin());
+  EXPECT_EQ(it, flat.begin());
+  set.erase(set.begin());
+  EXPECT_TRUE(flat == set);
+}
+
+TEST(FlatSet, T2Lookup) {
+  s21::FlatSet<int> flat{10, 20, 30};
+  EXPECT_EQ(*flat.Find(20), 20);
+  EXPECT_EQ(flat.Find(25), flat.end());
+  EXPECT_TRUE(flat.Contains(30));
+  EXPECT_FALSE(flat.Contains(5));
+  EXPECT_EQ(flat.Count(10), 1ull);
+  EXPECT_EQ(*flat.Lower_bound(15), 20);
+  EXPECT_EQ(*flat.Upper_bound(20), 30);
+  EXPECT_EQ(flat.Lower_bound(31), flat.end());
+  const auto [first, last] = flat.Equal_range(20);
+  EXPECT_EQ(last - first, 1);
+}
+
+TEST(FlatSet, T3InsertRange) {
+  std::mt19937 generator(7u);
+  std::vector<int> first, second;
+  for (int i = 0; i < 3000; ++i) first.push_back(generator() % 5000u);
+  for (int i = 0; i < 3000; ++i) second.push_back(generator() % 5000u);
+
+  s21::FlatSet<int> flat(first.begin(), first.end());
+  flat.Insert(second.begin(), second.end());
+  std::set<int> set(first.begin(), first.end());
+  set.insert(second.begin(), second.end());
+  EXPECT_TRUE(flat == set);
+
+  s21::FlatSet<int> other{-1, 0, 100000};
+  flat.Merge(std::move(other));
+  set.insert({-1, 0, 100000});
+  EXPECT_TRUE(flat == set);
+  EXPECT_TRUE(other.Empty());
+
+  s21::FlatSet<int> empty;
+  empty.Insert({3, 1, 2});
+  EXPECT_EQ(empty, (s21::FlatSet<int>{1, 2, 3}));
+}
+
+TEST(FlatSet, T4Swap) {
+  s21::FlatSet<int> left{1, 2};
+  s21::FlatSet<int> right{3};
+  left.Swap(right);
+  EXPECT_EQ(left.Size(), 1ull);
+  EXPECT_EQ(right.Size(), 2ull);
+  EXPECT_NE(left, right);
+  left.Clear();
+  EXPECT_TRUE(left.Empty());
+}
+
+}  // namespace
+
+// GCOVR_EXCL_STOP
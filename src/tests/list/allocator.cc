@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+
+#include <list>
+#include <memory_resource>
+
+#include "../../s21_list.h"
+#include "../allocator.h"
+#include "../item.h"
+#include "../list_helpers.h"
+
+// GCOVR_EXCL_START
+
+namespace {
+
+template <bool Propagate = false>
+using CountingList = s21::List<Item, CountingAllocator<Item, Propagate>>;
+
+TEST(List, T0AllocatorCounts) {
+  AllocationStatistics statistics;
+  {
+    CountingList<> s21_list{CountingAllocator<Item>(&statistics)};
+    std::list<Item> list;
+    for (int i = 0; i < 10; ++i) {
+      s21_list.Push_back(Item(i));
+      list.push_back(Item(i));
+    }
+    s21_list.Pop_front();
+    list.pop_front();
+
+    EXPECT_EQ(s21_list, list);
+    EXPECT_EQ(statistics.allocations, 10ull);  // one per node
+    EXPECT_EQ(statistics.deallocations, 1ull);
+  }
+  EXPECT_EQ(statistics.deallocations, statistics.allocations);
+  EXPECT_EQ(statistics.allocated, 0ull);
+}
+
+TEST(List, T0AllocatorExtract) {
+  AllocationStatistics statistics;
+  CountingList<> s21_list({Item(1), Item(2), Item(3)},
+                          CountingAllocator<Item>(&statistics));
+  {
+    auto node = s21_list.Extract(s21_list.cbegin());
+    EXPECT_EQ(node.Get(), Item(1));
+    EXPECT_EQ(statistics.deallocations, 0ull);
+  }
+  // the node is freed with the allocator of the list
+  EXPECT_EQ(statistics.deallocations, 1ull);
+  EXPECT_EQ(s21_list, std::list<Item>({Item(2), Item(3)}));
+}
+
+TEST(List, T0AllocatorMoveUnequal) {
+  AllocationStatistics statistics;
+  AllocationStatistics other_statistics;
+  CountingList<> s21_list({Item(1), Item(2), Item(3)},
+                          CountingAllocator<Item>(&statistics));
+
+  CountingList<> s21_other(std::move(s21_list),
+                           CountingAllocator<Item>(&other_statistics));
+
+  EXPECT_EQ(other_statistics.allocations, 3ull);
+  EXPECT_EQ(s21_other, std::list<Item>({Item(1), Item(2), Item(3)}));
+}
+
+// the nodes are recycled: only the missing ones are allocated
+TEST(List, T0AllocatorCopyAssignmentReuse) {
+  AllocationStatistics statistics;
+  const CountingList<> big({Item(1), Item(2), Item(3), Item(4)},
+                           CountingAllocator<Item>(&statistics));
+  const CountingList<> small({Item(7), Item(8)},
+                             CountingAllocator<Item>(&statistics));
+  CountingList<> s21_list{CountingAllocator<Item>(&statistics)};
+  EXPECT_EQ(statistics.allocations, 6ull);
+
+  s21_list = small;
+  EXPECT_EQ(statistics.allocations, 8ull);
+  s21_list = big;
+  EXPECT_EQ(statistics.allocations, 10ull);
+  EXPECT_EQ(s21_list, std::list<Item>({Item(1), Item(2), Item(3), Item(4)}));
+
+  s21_list = small;
+  EXPECT_EQ(statistics.allocations, 10ull);
+  EXPECT_EQ(statistics.deallocations, 2ull);
+  EXPECT_EQ(s21_list, std::list<Item>({Item(7), Item(8)}));
+  s21_list = small;
+  EXPECT_EQ(statistics.allocations, 10ull);
+}
+
+TEST(List, T0AllocatorCopyAssignmentPropagate) {
+  AllocationStatistics statistics;
+  AllocationStatistics other_statistics;
+  const CountingList<true> s21_list(
+      {Item(1), Item(2)}, CountingAllocator<Item, true>(&statistics));
+  CountingList<true> s21_other(
+      {Item(3)}, CountingAllocator<Item, true>(&other_statistics));
+
+  s21_other = s21_list;
+
+  EXPECT_TRUE((s21_other.Get_allocator() ==
+               CountingAllocator<Item, true>(&statistics)));
+  EXPECT_EQ(statistics.allocations, 4ull);
+  EXPECT_EQ(other_statistics.allocated, 0ull);
+  EXPECT_EQ(s21_other, std::list<Item>({Item(1), Item(2)}));
+}
+
+TEST(List, T0PolymorphicAllocator) {
+  char buffer[1024];
+  std::pmr::monotonic_buffer_resource resource(buffer, sizeof(buffer),
+                                               std::pmr::null_memory_resource());
+  s21::pmr::List<int> s21_list(&resource);
+  for (int i = 0; i < 5; ++i) s21_list.Push_back(i);
+
+  EXPECT_EQ(s21_list.Get_allocator().resource(), &resource);
+  EXPECT_TRUE(s21_list == std::list<int>({0, 1, 2, 3, 4}));
+}
+
+}  // namespace
+
+// GCOVR_EXCL_STOP
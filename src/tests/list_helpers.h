@@ -8,8 +8,8 @@
 
 // GCOVR_EXCL_START
 
-template <typename Type>
-bool operator==(const s21::List<Type> &s21_list, const std::list<Type> &list) {
+template <typename Type, typename... Parameters>
+bool operator==(const s21::List<Type, Parameters...> &s21_list, const std::list<Type> &list) {
   if (s21_list.Size() != list.size()) return false;
 
   auto iterator = list.cbegin();
@@ -24,13 +24,13 @@ bool operator==(const s21::List<Type> &s21_list, const std::list<Type> &list) {
   return true;
 }
 
-template <typename Type>
-bool operator==(const std::list<Type> &list, const s21::List<Type> &s21_list) {
+template <typename Type, typename... Parameters>
+bool operator==(const std::list<Type> &list, const s21::List<Type, Parameters...> &s21_list) {
   return s21_list == list;
 }
 
-template <typename Type>
-void print(const s21::List<Type> &s21_list) {
+template <typename Type, typename... Parameters>
+void print(const s21::List<Type, Parameters...> &s21_list) {
   for (auto it = s21_list.cbegin(); it != s21_list.cend(); ++it)
     std::cout << *it << '\n';
 }
@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <memory_resource>
+#include <set>
+
+#include "../../s21_map.h"
+#include "../../s21_set.h"
+#include "../allocator.h"
+#include "../item.h"
+#include "../map_helpers.h"
+
+// GCOVR_EXCL_START
+
+namespace {
+
+template <bool Propagate = false>
+using CountingMap =
+    s21::Map<int, Item, s21::Utility::Less<const int>,
+             CountingAllocator<std::pair<const int, Item>, Propagate>>;
+using Allocator = CountingAllocator<std::pair<const int, Item>>;
+
+TEST(Map, T0AllocatorCounts) {
+  AllocationStatistics statistics;
+  {
+    CountingMap<> s21_map{Allocator(&statistics)};
+    std::map<int, Item> map;
+    for (int i = 0; i < 10; ++i) {
+      s21_map.Insert({i, Item(i)});
+      map.insert({i, Item(i)});
+    }
+    s21_map.Erase(s21_map.cbegin());
+    map.erase(map.cbegin());
+
+    EXPECT_EQ(s21_map, map);
+    EXPECT_EQ(statistics.allocations, 10ull);  // one per node
+    EXPECT_EQ(statistics.deallocations, 1ull);
+  }
+  EXPECT_EQ(statistics.deallocations, statistics.allocations);
+  EXPECT_EQ(statistics.allocated, 0ull);
+}
+
+TEST(Map, T0AllocatorCopyAndExtract) {
+  AllocationStatistics statistics;
+  AllocationStatistics other_statistics;
+  CountingMap<> s21_map({{1, Item(1)}, {2, Item(2)}, {3, Item(3)}},
+                        Allocator(&statistics));
+
+  CountingMap<> s21_copy(s21_map, Allocator(&other_statistics));
+  EXPECT_EQ(other_statistics.allocations, 3ull);
+  {
+    auto node = s21_copy.Extract(s21_copy.cbegin());
+    EXPECT_EQ(node.Get().second, Item(1));
+  }
+  EXPECT_EQ(other_statistics.deallocations, 1ull);
+  EXPECT_EQ(statistics.deallocations, 0ull);
+  const std::map<int, Item> map{{2, Item(2)}, {3, Item(3)}};
+  EXPECT_EQ(s21_copy, map);
+}
+
+TEST(Map, T0AllocatorMoveUnequal) {
+  AllocationStatistics statistics;
+  AllocationStatistics other_statistics;
+  CountingMap<> s21_map({{1, Item(1)}, {2, Item(2)}, {3, Item(3)}},
+                        Allocator(&statistics));
+  CountingMap<> s21_other{Allocator(&other_statistics)};
+
+  s21_other = std::move(s21_map);
+
+  EXPECT_EQ(other_statistics.allocations, 3ull);
+  EXPECT_EQ(statistics.allocated, 0ull);
+  EXPECT_TRUE(s21_map.Empty());
+  const std::map<int, Item> map{{1, Item(1)}, {2, Item(2)}, {3, Item(3)}};
+  EXPECT_EQ(s21_other, map);
+}
+
+TEST(Map, T0AllocatorSwapPropagate) {
+  using PropagatingAllocator =
+      CountingAllocator<std::pair<const int, Item>, true>;
+  AllocationStatistics statistics;
+  AllocationStatistics other_statistics;
+  CountingMap<true> s21_map({{1, Item(1)}},
+                            PropagatingAllocator(&statistics));
+  CountingMap<true> s21_other({{2, Item(2)}},
+                              PropagatingAllocator(&other_statistics));
+
+  s21_map.Swap(s21_other);
+
+  EXPECT_TRUE(s21_map.Get_allocator() ==
+              PropagatingAllocator(&other_statistics));
+  const std::map<int, Item> map{{2, Item(2)}};
+  const std::map<int, Item> other_map{{1, Item(1)}};
+  EXPECT_EQ(s21_map, map);
+  EXPECT_EQ(s21_other, other_map);
+}
+
+TEST(Map, T0PolymorphicAllocator) {
+  char buffer[1024];
+  std::pmr::monotonic_buffer_resource resource(buffer, sizeof(buffer),
+                                               std::pmr::null_memory_resource());
+  s21::pmr::Map<int, int> s21_map(&resource);
+  s21::pmr::Set<int> s21_set(&resource);
+  for (int i = 0; i < 5; ++i) {
+    s21_map.Insert({i, i * i});
+    s21_set.Insert(i);
+  }
+
+  EXPECT_EQ(s21_map.Get_allocator().resource(), &resource);
+  EXPECT_EQ(s21_set.Get_allocator().resource(), &resource);
+  EXPECT_EQ(s21_map.Size(), 5ull);
+  EXPECT_TRUE(s21_set.Contains(4));
+}
+
+}  // namespace
+
+// GCOVR_EXCL_STOP
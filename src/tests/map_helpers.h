@@ -28,8 +28,8 @@ bool operator!=(const std::pair<const Key, s21::Vector<Type>>& multipair,
   return !(multipair == pair);
 }
 
-template <typename Key, typename Type>
-bool operator==(const s21::Map<Key, Type>& s21_map,
+template <typename Key, typename Type, typename... Parameters>
+bool operator==(const s21::Map<Key, Type, Parameters...>& s21_map,
                 const std::map<Key, Type>& map) {
   if (s21_map.Size() != map.size()) return false;
 
@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <memory_resource>
+
+#include "../../s21_multimap.h"
+#include "../../s21_multiset.h"
+#include "../allocator.h"
+#include "../item.h"
+#include "../multimap_helpers.h"
+
+// GCOVR_EXCL_START
+
+namespace {
+
+using Allocator = CountingAllocator<std::pair<const int, Item>>;
+using CountingMultiMap =
+    s21::MultiMap<int, Item, s21::Utility::Less<const int>, Allocator>;
+
+TEST(MultiMap, T0AllocatorCounts) {
+  AllocationStatistics statistics;
+  {
+    CountingMultiMap s21_multimap{Allocator(&statistics)};
+    std::multimap<int, Item> multimap;
+    for (int i = 0; i < 10; ++i) {
+      s21_multimap.Insert({i % 2, Item(i)});
+      multimap.insert({i % 2, Item(i)});
+    }
+
+    EXPECT_EQ(s21_multimap, multimap);
+    // both the tree nodes and the spilled groups are allocated by it
+    EXPECT_GT(statistics.allocations, 2ull);
+  }
+  EXPECT_EQ(statistics.deallocations, statistics.allocations);
+  EXPECT_EQ(statistics.allocated, 0ull);
+}
+
+TEST(MultiMap, T0AllocatorExtract) {
+  AllocationStatistics statistics;
+  CountingMultiMap s21_multimap({{1, Item(1)}, {1, Item(2)}},
+                                Allocator(&statistics));
+  const std::size_t allocations = statistics.allocations;
+  {
+    auto node = s21_multimap.Extract(s21_multimap.cbegin());
+    EXPECT_EQ(node.Get().second, Item(1));
+    // the node and a chunk for the rest of the group: moving Item may throw,
+    // so the group is not shifted in place
+    EXPECT_EQ(statistics.allocations, allocations + 2ull);
+  }
+  const std::multimap<int, Item> multimap{{1, Item(2)}};
+  EXPECT_EQ(s21_multimap, multimap);
+  s21_multimap.Clear();
+  EXPECT_EQ(statistics.allocated, 0ull);
+}
+
+TEST(MultiSet, T0PolymorphicAllocator) {
+  char buffer[4096];
+  std::pmr::monotonic_buffer_resource resource(buffer, sizeof(buffer),
+                                               std::pmr::null_memory_resource());
+  s21::pmr::MultiSet<int> s21_multiset(&resource);
+  s21::pmr::CountedMultiSet<int> s21_counted(&resource);
+  for (int i = 0; i < 20; ++i) {
+    s21_multiset.Insert(i % 3);
+    s21_counted.Insert(i % 3);
+  }
+
+  EXPECT_EQ(s21_multiset.Get_allocator().resource(), &resource);
+  EXPECT_EQ(s21_multiset.Count(0), 7ull);
+  EXPECT_EQ(s21_counted.Count(0), 7ull);
+}
+
+TEST(MultiMap, T0PolymorphicMoveKeepsResource) {
+  std::pmr::unsynchronized_pool_resource resource;
+  s21::pmr::MultiMap<int, Item> s21_multimap(&resource);
+  for (int i = 0; i < 10; ++i) s21_multimap.Insert({i % 2, Item(i)});
+
+  s21::pmr::MultiMap<int, Item> moved(std::move(s21_multimap));
+
+  EXPECT_EQ(moved.Get_allocator().resource(), &resource);
+  EXPECT_EQ(moved.Size(), 10ull);
+  EXPECT_EQ(moved.Count(1), 5ull);
+  EXPECT_TRUE(s21_multimap.Empty());
+}
+
+TEST(MultiMap, T0AllocatorExtendedConstructors) {
+  std::pmr::unsynchronized_pool_resource first;
+  std::pmr::unsynchronized_pool_resource second;
+  s21::pmr::MultiMap<int, Item> s21_multimap(&first);
+  std::multimap<int, Item> multimap;
+  for (int i = 0; i < 10; ++i) {
+    s21_multimap.Insert({i % 3, Item(i)});
+    multimap.insert({i % 3, Item(i)});
+  }
+
+  s21::pmr::MultiMap<int, Item> copy(s21_multimap, &second);
+  EXPECT_EQ(copy.Get_allocator().resource(), &second);
+  EXPECT_EQ(copy, multimap);
+  EXPECT_EQ(s21_multimap, multimap);
+
+  // other memory: the groups are moved one by one
+  s21::pmr::MultiMap<int, Item> moved(std::move(copy), &first);
+  EXPECT_EQ(moved.Get_allocator().resource(), &first);
+  EXPECT_EQ(moved, multimap);
+  EXPECT_TRUE(copy.Empty());
+
+  // the same memory: the nodes are taken
+  s21::pmr::MultiMap<int, Item> taken(std::move(moved), &first);
+  EXPECT_EQ(taken, multimap);
+  EXPECT_TRUE(moved.Empty());
+}
+
+TEST(MultiSet, T0AllocatorExtendedCounted) {
+  std::pmr::unsynchronized_pool_resource first;
+  std::pmr::unsynchronized_pool_resource second;
+  s21::pmr::CountedMultiSet<int> s21_counted({1, 1, 2, 3, 3, 3}, &first);
+
+  s21::pmr::CountedMultiSet<int> copy(s21_counted, &second);
+  s21::pmr::CountedMultiSet<int> moved(std::move(s21_counted), &second);
+
+  EXPECT_EQ(copy.Get_allocator().resource(), &second);
+  EXPECT_EQ(moved.Get_allocator().resource(), &second);
+  EXPECT_EQ(copy.Count(3), 3ull);
+  EXPECT_EQ(moved.Size(), 6ull);
+  EXPECT_TRUE(s21_counted.Empty());
+}
+
+}  // namespace
+
+// GCOVR_EXCL_STOP
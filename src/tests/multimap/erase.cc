@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 
 #include <map>
+#include <stdexcept>
 
 #include "../../s21_multimap.h"
 #include "../item.h"
@@ -726,6 +727,127 @@ TEST(MultiMap, T1RandomExtract) {
   EXPECT_TRUE(minimalHeightAVL(s21_multimap.Size(), s21_multimap.Height()));
 }
 
+TEST(MultiMap, T0ManyDuplicatesErase) {
+  s21::MultiMap<int, Item> s21_multimap;
+  std::multimap<int, Item> multimap;
+  for (int value = 0; value < 20; ++value) {
+    for (int key = 0; key < 7; ++key) {
+      s21_multimap.Insert(std::make_pair(key, Item(value)));
+      multimap.insert(std::make_pair(key, Item(value)));
+    }
+  }
+  EXPECT_EQ(s21_multimap, multimap);
+
+  auto s21_it = s21_multimap.cbegin();
+  auto it = multimap.cbegin();
+  int counter = 0;
+  while (it != multimap.cend()) {
+    if (counter++ % 3) {
+      ++s21_it;
+      ++it;
+      continue;
+    }
+    auto s21_next = s21_multimap.Erase(s21_it);
+    auto next = multimap.erase(it);
+    if (next != multimap.end()) {
+      EXPECT_EQ(*s21_next, *next);
+    }
+    s21_it = static_cast<s21::MultiMap<int, Item>::const_iterator>(s21_next);
+    it = next;
+  }
+
+  EXPECT_EQ(s21_multimap, multimap);
+  EXPECT_TRUE(minimalHeightAVL(s21_multimap.Size(), s21_multimap.Height()));
+}
+
+TEST(MultiMap, T0ManyDuplicatesExtract) {
+  s21::MultiMap<int, Item> s21_multimap;
+  std::multimap<int, Item> multimap;
+  for (int value = 0; value < 20; ++value) {
+    s21_multimap.Insert(std::make_pair(1, Item(value)));
+    multimap.insert(std::make_pair(1, Item(value)));
+  }
+
+  auto s21_it = s21_multimap.cbegin();
+  auto it = multimap.cbegin();
+  for (int i = 0; i < 11; ++i) {
+    ++s21_it;
+    ++it;
+  }
+
+  s21::MultiMap<int, Item>::node_type s21_it_result =
+      s21_multimap.Extract(s21_it);
+  std::multimap<int, Item>::node_type it_result = multimap.extract(it);
+
+  EXPECT_EQ(it_result.key(), s21_it_result.Get().first);
+  EXPECT_EQ(it_result.mapped(), s21_it_result.Get().second);
+  EXPECT_EQ(s21_multimap, multimap);
+}
+
+TEST(MultiMap, T0EraseBefore) {
+  s21::MultiMap<int, Item> s21_multimap;
+  std::multimap<int, Item> multimap;
+  for (int i = 0; i < 500; ++i) {
+    s21_multimap.Insert(std::make_pair(i / 4, Item(i)));
+    multimap.insert(std::make_pair(i / 4, Item(i)));
+  }
+
+  EXPECT_EQ(s21_multimap.Erase_before(-5), 0ull);
+  EXPECT_EQ(s21_multimap.Erase_before(0), 0ull);
+  EXPECT_EQ(s21_multimap, multimap);
+
+  EXPECT_EQ(s21_multimap.Erase_before(50), 200ull);
+  multimap.erase(multimap.begin(), multimap.lower_bound(50));
+  EXPECT_EQ(s21_multimap, multimap);
+  EXPECT_EQ((*s21_multimap.begin()).first, 50);
+
+  // keep appending after trimming
+  for (int i = 500; i < 600; ++i) {
+    s21_multimap.Insert(std::make_pair(i / 4, Item(i)));
+    multimap.insert(std::make_pair(i / 4, Item(i)));
+  }
+  EXPECT_EQ(s21_multimap, multimap);
+
+  EXPECT_EQ(s21_multimap.Erase_before(1000), 400ull);
+  EXPECT_TRUE(s21_multimap.Empty());
+  EXPECT_EQ(s21_multimap.begin(), s21_multimap.end());
+}
+
+// copies throw on demand and there is no move constructor, so moving it
+// may throw too
+class Fragile {
+ public:
+  inline static bool fail = false;
+
+  explicit Fragile(int value) : value_{value} {}
+  Fragile(const Fragile& other) : value_{other.value_} {
+    if (fail) throw std::runtime_error("Copy failed!");
+  }
+
+  int value() const noexcept { return value_; }
+
+ private:
+  int value_;
+};
+
+TEST(MultiMap, T0EraseThrowingCopyKeepsGroup) {
+  s21::MultiMap<int, Fragile> s21_multimap;
+  for (int i = 0; i < 4; ++i) s21_multimap.Insert({1, Fragile(i)});
+
+  Fragile::fail = true;
+  EXPECT_THROW(s21_multimap.Erase(s21_multimap.cbegin()), std::runtime_error);
+  Fragile::fail = false;
+
+  EXPECT_EQ(s21_multimap.Size(), 4ull);
+  int expected = 0;
+  for (const auto& pair : s21_multimap)
+    EXPECT_EQ(pair.second.value(), expected++);
+
+  s21_multimap.Erase(++s21_multimap.cbegin());
+  EXPECT_EQ(s21_multimap.Size(), 3ull);
+  EXPECT_EQ((++s21_multimap.cbegin())->second.value(), 2);
+}
+
 }  // namespace
 
 // GCOVR_EXCL_STOP
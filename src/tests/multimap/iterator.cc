@@ -329,6 +329,41 @@ TEST(Map, T0ReverseIteratorOperatorPlusPost) {
     EXPECT_EQ(*(s21_it++), *(it++));
 }
 
+TEST(MultiMap, T0IteratorSize) {
+  EXPECT_LE(sizeof(s21::MultiMap<int, Item>::iterator), 2ull * sizeof(void*));
+  EXPECT_LE(sizeof(s21::MultiMap<int, Item>::const_reverse_iterator),
+            2ull * sizeof(void*));
+}
+
+TEST(MultiMap, T0IteratorEraseWhileIterating) {
+  s21::MultiMap<int, Item> s21_multimap;
+  std::multimap<int, Item> multimap;
+  for (int i = 0; i < 50; ++i) {
+    s21_multimap.Insert(std::make_pair(i % 5, Item(i)));
+    multimap.insert(std::make_pair(i % 5, Item(i)));
+  }
+
+  auto s21_it = s21_multimap.begin();
+  auto it = multimap.begin();
+  while (it != multimap.end()) {
+    if ((*it).second.number() % 2) {
+      s21_it = s21_multimap.Erase(s21_it);
+      it = multimap.erase(it);
+    } else {
+      ++s21_it;
+      ++it;
+    }
+  }
+  EXPECT_EQ(s21_it, s21_multimap.end());
+  EXPECT_EQ(s21_multimap, multimap);
+
+  auto s21_reverse_it = s21_multimap.crbegin();
+  auto reverse_it = multimap.crbegin();
+  while (reverse_it != multimap.crend())
+    EXPECT_EQ(*(s21_reverse_it++), *(reverse_it++));
+  EXPECT_EQ(s21_reverse_it, s21_multimap.crend());
+}
+
 }  // namespace
 
 // GCOVR_EXCL_STOP
@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 
 #include <map>
+#include <string>
 
 #include "../../s21_multimap.h"
 #include "../item.h"
@@ -1012,6 +1013,31 @@ TEST(Map, T8EqualRange) {
   // static_assert(0 && "??");
 }
 
+TEST(Map, T0SpilledGroupsKeepKeys) {
+  s21::MultiMap<std::string, int> s21_multimap;
+  std::multimap<std::string, int> multimap;
+  for (int i = 0; i < 60; ++i) {
+    const std::string key(40, static_cast<char>('a' + i % 6));
+    s21_multimap.Insert({key, i});
+    multimap.insert({key, i});
+  }
+
+  // a group keeps its key while its elements are extracted and moved out
+  for (int i = 0; i < 10; ++i) {
+    auto node = s21_multimap.Extract(s21_multimap.Find(std::string(40, 'c')));
+    EXPECT_EQ(node.Get().second, i * 6 + 2);
+  }
+  multimap.erase(std::string(40, 'c'));
+
+  EXPECT_FALSE(s21_multimap.Contains(std::string(40, 'c')));
+  EXPECT_EQ(s21_multimap.Count(std::string(40, 'd')), 10ull);
+  EXPECT_EQ(s21_multimap.Lower_bound(std::string(40, 'c'))->first,
+            std::string(40, 'd'));
+  EXPECT_EQ(s21_multimap.Size(), multimap.size());
+  auto it = multimap.cbegin();
+  for (const auto& pair : s21_multimap) EXPECT_EQ(pair, *it++);
+}
+
 }  // namespace
 
 // GCOVR_EXCL_STOP
\ No newline at end of file
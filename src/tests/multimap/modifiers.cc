@@ -1,8 +1,10 @@
 #include <gtest/gtest.h>
 
 #include <map>
+#include <stdexcept>
 
 #include "../../s21_multimap.h"
+#include "../counter.h"
 #include "../item.h"
 #include "../multimap_helpers.h"
 
@@ -264,6 +266,222 @@ TEST(MultiMap, T6SwapEmpty) {
   EXPECT_EQ(s21_multimap2, s21_copy1);
 }
 
+TEST(MultiMap, T0InsertCopies) {
+  s21::MultiMap<int, Counter> s21_multimap;
+  const std::pair<const int, Counter> value(1, Counter(1));
+
+  Counter::Reset();
+  s21_multimap.Insert(value);
+  s21_multimap.Insert(value);
+  EXPECT_EQ(Counter::copies, 2ull);
+
+  Counter::Reset();
+  s21_multimap.Insert(std::make_pair(2, Counter(2)));
+  s21_multimap.Insert(std::make_pair(2, Counter(2)));
+  EXPECT_EQ(Counter::copies, 0ull);
+
+  std::multimap<int, Counter> multimap{
+      {1, Counter(1)}, {1, Counter(1)}, {2, Counter(2)}, {2, Counter(2)}};
+  EXPECT_EQ(s21_multimap, multimap);
+}
+
+TEST(MultiMap, T0Emplace) {
+  s21::MultiMap<int, Counter> s21_multimap;
+  std::multimap<int, Counter> multimap;
+
+  Counter::Reset();
+  for (int i = 0; i < 20; ++i) {
+    auto s21_it = s21_multimap.Emplace(i % 3, Counter(i));
+    multimap.emplace(i % 3, Counter(i));
+    EXPECT_EQ((*s21_it).first, i % 3);
+    EXPECT_EQ((*s21_it).second, Counter(i));
+  }
+  EXPECT_EQ(Counter::copies, 0ull);
+  EXPECT_EQ(s21_multimap, multimap);
+}
+
+TEST(MultiMap, T0EmplaceHint) {
+  s21::MultiMap<int, Counter> s21_multimap;
+  std::multimap<int, Counter> multimap;
+
+  for (int i = 0; i < 30; ++i) {
+    auto s21_it =
+        s21_multimap.Emplace_hint(s21_multimap.cend(), i / 3, Counter(i));
+    multimap.emplace_hint(multimap.cend(), i / 3, Counter(i));
+    EXPECT_EQ((*s21_it).second, Counter(i));
+  }
+  EXPECT_EQ(s21_multimap, multimap);
+
+  // hint into the group, before the group and a wrong one
+  s21_multimap.Emplace_hint(s21_multimap.Find(5), 5, Counter(100));
+  multimap.emplace_hint(multimap.find(5), 5, Counter(100));
+  s21_multimap.Emplace_hint(++s21_multimap.Find(5), 5, Counter(104));
+  multimap.emplace_hint(++multimap.find(5), 5, Counter(104));
+  s21_multimap.Emplace_hint(s21_multimap.Find(6), 5, Counter(101));
+  multimap.emplace_hint(multimap.upper_bound(5), 5, Counter(101));
+  s21_multimap.Emplace_hint(s21_multimap.cbegin(), 7, Counter(102));
+  multimap.emplace_hint(multimap.upper_bound(7), 7, Counter(102));
+  s21_multimap.Emplace_hint(s21_multimap.cbegin(), -1, Counter(103));
+  multimap.emplace_hint(multimap.begin(), -1, Counter(103));
+  EXPECT_EQ(s21_multimap, multimap);
+}
+
+TEST(MultiMap, T0EmplaceHintIntoGroup) {
+  s21::MultiMap<int, Item> s21_multimap;
+  for (int i = 0; i < 5; ++i) s21_multimap.Insert(std::make_pair(1, Item(i)));
+
+  // the group spills, the element goes right before hint
+  auto s21_hint = ++(++s21_multimap.cbegin());
+  auto s21_it = s21_multimap.Emplace_hint(s21_hint, 1, Item(10));
+  EXPECT_EQ(s21_it, ++(++s21_multimap.begin()));
+  const int numbers[] = {0, 1, 10, 2, 3, 4};
+  int i = 0;
+  for (const auto& element : s21_multimap)
+    EXPECT_EQ(element.second, Item(numbers[i++]));
+  EXPECT_EQ(s21_multimap.Size(), 6ull);
+}
+
+TEST(MultiMap, T0EmplaceHintEmpty) {
+  s21::MultiMap<int, Counter> s21_multimap;
+  auto s21_it = s21_multimap.Emplace_hint(s21_multimap.cend(), 1, Counter(1));
+  EXPECT_EQ(s21_it, s21_multimap.begin());
+  EXPECT_EQ(s21_multimap.Size(), 1ull);
+}
+
+TEST(MultiMap, T0InsertManyUnsorted) {
+  s21::MultiMap<int, Counter> s21_multimap{{3, Counter(-3)}, {1, Counter(-1)}};
+  std::multimap<int, Counter> multimap{{3, Counter(-3)}, {1, Counter(-1)}};
+
+  Counter::Reset();
+  auto s21_result = s21_multimap.Insert_many(
+      std::make_pair(5, Counter(0)), std::make_pair(3, Counter(1)),
+      std::make_pair(5, Counter(2)), std::make_pair(0, Counter(3)),
+      std::make_pair(3, Counter(4)), std::make_pair(5, Counter(5)));
+  EXPECT_EQ(Counter::copies, 0ull);
+
+  const int keys[] = {5, 3, 5, 0, 3, 5};
+  for (int i = 0; i < 6; ++i) multimap.emplace(keys[i], Counter(i));
+  EXPECT_EQ(s21_multimap, multimap);
+
+  ASSERT_EQ(s21_result.Size(), 6ull);
+  for (int i = 0; i < 6; ++i) {
+    EXPECT_TRUE(s21_result[i].second);
+    EXPECT_EQ((*s21_result[i].first).first, keys[i]);
+    EXPECT_EQ((*s21_result[i].first).second, Counter(i));
+  }
+}
+
+// value whose moves throw once the budget is over
+class Fragile {
+ public:
+  inline static int moves_left = 0;
+
+ private:
+  int number_;
+
+ public:
+  explicit Fragile(int number) : number_{number} {}
+  Fragile(const Fragile& other) = default;
+  Fragile(Fragile&& other) : number_{other.number_} {
+    if (!moves_left--) throw std::runtime_error("Fragile");
+  }
+  Fragile& operator=(const Fragile& other) = default;
+
+  int number() const noexcept { return number_; }
+};
+
+TEST(MultiMap, T0InsertManyThrowKeepsSize) {
+  s21::MultiMap<int, Fragile> s21_multimap;
+  Fragile::moves_left = 100;
+  s21_multimap.Emplace(1, Fragile(0));
+  s21_multimap.Emplace(2, Fragile(0));
+
+  // 8 moves build the values, the first one gets into the group of 1 and
+  // the second one throws
+  Fragile::moves_left = 9;
+  EXPECT_THROW(s21_multimap.Insert_many(std::make_pair(1, Fragile(1)),
+                                        std::make_pair(1, Fragile(2)),
+                                        std::make_pair(1, Fragile(3)),
+                                        std::make_pair(2, Fragile(4))),
+               std::runtime_error);
+  std::size_t count = 0ull;
+  for (auto it = s21_multimap.cbegin(); it != s21_multimap.cend(); ++it)
+    ++count;
+  EXPECT_EQ(count, 3ull);
+  EXPECT_EQ(s21_multimap.Size(), count);
+  Fragile::moves_left = 100;
+}
+
+TEST(MultiMap, T0EmplaceHintThrowingMove) {
+  s21::MultiMap<int, Fragile> s21_multimap;
+  Fragile::moves_left = 100;
+  for (int i = 0; i < 3; ++i) s21_multimap.Emplace(1, Fragile(i));
+
+  // the elements are copied around the new one
+  s21_multimap.Emplace_hint(++s21_multimap.cbegin(), 1, Fragile(10));
+  const int numbers[] = {0, 10, 1, 2};
+  int i = 0;
+  for (const auto& element : s21_multimap)
+    EXPECT_EQ(element.second.number(), numbers[i++]);
+  EXPECT_EQ(s21_multimap.Size(), 4ull);
+}
+
+// key which can not be default constructed
+class Id {
+ private:
+  int value_;
+
+ public:
+  explicit Id(int value) : value_{value} {}
+
+  bool operator<(const Id& right) const { return value_ < right.value_; }
+};
+
+TEST(MultiMap, T0KeyNotDefaultConstructible) {
+  s21::MultiMap<Id, int> s21_multimap;
+  for (int i = 0; i < 10; ++i)
+    s21_multimap.Insert(std::make_pair(Id(i % 3), i));
+
+  EXPECT_EQ(s21_multimap.Size(), 10ull);
+  EXPECT_EQ(s21_multimap.Count(Id(1)), 3ull);
+  EXPECT_EQ(s21_multimap.Erase(Id(0)), 4ull);
+  EXPECT_EQ((*s21_multimap.begin()).second, 1);
+}
+
+TEST(MultiMap, T0InsertAscending) {
+  s21::MultiMap<int, Item> s21_multimap;
+  std::multimap<int, Item> multimap;
+
+  for (int i = 0; i < 3000; ++i) {
+    const int timestamp = i / 3;
+    auto [s21_it, inserted] =
+        s21_multimap.Insert(std::make_pair(timestamp, Item(i)));
+    multimap.insert(std::make_pair(timestamp, Item(i)));
+    EXPECT_TRUE(inserted);
+    EXPECT_EQ((*s21_it).second, Item(i));
+  }
+  EXPECT_EQ(s21_multimap, multimap);
+  EXPECT_LE(s21_multimap.Height(), 15ull);  // 1.44 * log2(1000)
+  EXPECT_EQ((*(--s21_multimap.end())).first, 999);
+}
+
+TEST(MultiMap, T0InsertMostlyAscending) {
+  s21::MultiMap<int, Item> s21_multimap;
+  std::multimap<int, Item> multimap;
+
+  for (int i = 0; i < 2000; ++i) {
+    const int timestamp = i % 10 ? i : i - 15;  // some samples are late
+    s21_multimap.Insert(std::make_pair(timestamp, Item(i)));
+    multimap.insert(std::make_pair(timestamp, Item(i)));
+  }
+  EXPECT_EQ(s21_multimap, multimap);
+  EXPECT_LE(s21_multimap.Height(), 16ull);
+
+  auto s21_it = s21_multimap.crbegin();
+  for (auto it = multimap.crbegin(); it != multimap.crend(); ++it)
+    EXPECT_EQ(*(s21_it++), *it);
+}
+
 }  // namespace
 
 // GCOVR_EXCL_STOP
@@ -11,8 +11,8 @@
 
 // GCOVR_EXCL_START
 
-template <typename Key, typename Type>
-bool operator==(const s21::MultiMap<Key, Type>& s21_mmap,
+template <typename Key, typename Type, typename... Parameters>
+bool operator==(const s21::MultiMap<Key, Type, Parameters...>& s21_mmap,
                 const std::multimap<Key, Type>& mmap) {
   if (s21_mmap.Size() != mmap.size()) return false;
 
@@ -0,0 +1,179 @@
+#include <gtest/gtest.h>
+
+#include <set>
+
+#include "../../s21_multiset.h"
+#include "../multiset_helpers.h"
+#include "../tree_helpers.h"
+
+// GCOVR_EXCL_START
+
+namespace {
+
+TEST(CountedMultiSet, T0Insert) {
+  s21::CountedMultiSet<int> s21_multiset;
+  std::multiset<int> multiset;
+  for (int i = 0; i < 200; ++i) {
+    s21_multiset.Insert(i % 7);
+    multiset.insert(i % 7);
+  }
+
+  EXPECT_TRUE(s21_multiset == multiset);
+  EXPECT_EQ(s21_multiset.Size(), 200ull);
+  EXPECT_TRUE(minimalHeightAVL(7ull, s21_multiset.Height()));
+}
+
+TEST(CountedMultiSet, T0ConstructorInitializer) {
+  const s21::CountedMultiSet<int> s21_multiset{5, 1, 5, 3, 1, 5, -2};
+  const std::multiset<int> multiset{5, 1, 5, 3, 1, 5, -2};
+
+  EXPECT_TRUE(s21_multiset == multiset);
+}
+
+TEST(CountedMultiSet, T0InsertResult) {
+  s21::CountedMultiSet<int> s21_multiset{4, 4, 2};
+
+  const auto [s21_it, inserted] = s21_multiset.Insert(4);
+
+  EXPECT_TRUE(inserted);
+  EXPECT_EQ(*s21_it, 4);
+  auto next = s21_it;
+  ++next;
+  EXPECT_EQ(next, s21_multiset.end());
+}
+
+TEST(CountedMultiSet, T0Count) {
+  const s21::CountedMultiSet<int> s21_multiset{5, 1, 5, 3, 1, 5, -2};
+  const std::multiset<int> multiset{5, 1, 5, 3, 1, 5, -2};
+
+  for (int key = -3; key < 7; ++key)
+    EXPECT_EQ(s21_multiset.Count(key), multiset.count(key));
+}
+
+TEST(CountedMultiSet, T0ReverseIterator) {
+  s21::CountedMultiSet<int> s21_multiset{5, 1, 5, 3, 1, 5, -2};
+  std::multiset<int> multiset{5, 1, 5, 3, 1, 5, -2};
+
+  auto s21_it = s21_multiset.rbegin();
+  auto it = multiset.rbegin();
+  while (it != multiset.rend()) {
+    EXPECT_EQ(*s21_it, *it);
+    ++s21_it;
+    ++it;
+  }
+  EXPECT_EQ(s21_it, s21_multiset.rend());
+}
+
+TEST(CountedMultiSet, T0Decrement) {
+  s21::CountedMultiSet<int> s21_multiset{5, 1, 5, 3, 1, 5, -2};
+  std::multiset<int> multiset{5, 1, 5, 3, 1, 5, -2};
+
+  auto s21_it = s21_multiset.end();
+  auto it = multiset.end();
+  while (it != multiset.begin()) {
+    --s21_it;
+    --it;
+    EXPECT_EQ(*s21_it, *it);
+  }
+  EXPECT_EQ(s21_it, s21_multiset.begin());
+}
+
+TEST(CountedMultiSet, T0EraseOne) {
+  s21::CountedMultiSet<int> s21_multiset{5, 1, 5, 3, 1, 5, -2};
+  std::multiset<int> multiset{5, 1, 5, 3, 1, 5, -2};
+
+  auto s21_it = s21_multiset.Erase(s21_multiset.Find(5));
+  auto it = multiset.erase(multiset.find(5));
+
+  EXPECT_EQ(*s21_it, *it);
+  EXPECT_TRUE(s21_multiset == multiset);
+  EXPECT_EQ(s21_multiset.Count(5), 2ull);
+}
+
+TEST(CountedMultiSet, T1EraseOneLast) {
+  s21::CountedMultiSet<int> s21_multiset{5, 1, 5, 3, 1, 5, -2};
+  std::multiset<int> multiset{5, 1, 5, 3, 1, 5, -2};
+
+  auto s21_it = s21_multiset.Erase(s21_multiset.Find(3));
+  auto it = multiset.erase(multiset.find(3));
+
+  EXPECT_EQ(*s21_it, *it);
+  EXPECT_TRUE(s21_multiset == multiset);
+  EXPECT_FALSE(s21_multiset.Contains(3));
+}
+
+TEST(CountedMultiSet, T2EraseAllOneByOne) {
+  s21::CountedMultiSet<int> s21_multiset{5, 1, 5, 3, 1, 5, -2};
+
+  auto it = s21_multiset.cbegin();
+  while (it != s21_multiset.cend())
+    it = static_cast<s21::CountedMultiSet<int>::const_iterator>(
+        s21_multiset.Erase(it));
+
+  EXPECT_TRUE(s21_multiset.Empty());
+  EXPECT_EQ(s21_multiset.Size(), 0ull);
+}
+
+TEST(CountedMultiSet, T0EraseKey) {
+  s21::CountedMultiSet<int> s21_multiset{5, 1, 5, 3, 1, 5, -2};
+  std::multiset<int> multiset{5, 1, 5, 3, 1, 5, -2};
+
+  EXPECT_EQ(s21_multiset.Erase(5), multiset.erase(5));
+  EXPECT_EQ(s21_multiset.Erase(7), multiset.erase(7));
+  EXPECT_TRUE(s21_multiset == multiset);
+}
+
+TEST(CountedMultiSet, T0Extract) {
+  s21::CountedMultiSet<int> s21_multiset{5, 1, 5, 3, 1, 5, -2};
+  std::multiset<int> multiset{5, 1, 5, 3, 1, 5, -2};
+
+  auto s21_node = s21_multiset.Extract(s21_multiset.Find(1));
+  auto node = multiset.extract(multiset.find(1));
+
+  EXPECT_EQ(s21_node.Get(), node.value());
+  EXPECT_TRUE(s21_multiset == multiset);
+}
+
+TEST(CountedMultiSet, T0Bounds) {
+  const s21::CountedMultiSet<int> s21_multiset{5, 1, 5, 3, 1, 5, -2};
+  const std::multiset<int> multiset{5, 1, 5, 3, 1, 5, -2};
+
+  EXPECT_EQ(*s21_multiset.Lower_bound(2), *multiset.lower_bound(2));
+  EXPECT_EQ(*s21_multiset.Upper_bound(3), *multiset.upper_bound(3));
+
+  const auto [s21_first, s21_last] = s21_multiset.Equal_range(1);
+  const auto [first, last] = multiset.equal_range(1);
+  EXPECT_EQ(*s21_first, *first);
+  EXPECT_EQ(*s21_last, *last);
+}
+
+TEST(CountedMultiSet, T0CopyAndMove) {
+  const s21::CountedMultiSet<int> s21_source{5, 1, 5, 3, 1, 5, -2};
+  const std::multiset<int> source{5, 1, 5, 3, 1, 5, -2};
+
+  s21::CountedMultiSet<int> s21_copy(s21_source);
+  EXPECT_TRUE(s21_copy == source);
+
+  s21::CountedMultiSet<int> s21_moved(std::move(s21_copy));
+  EXPECT_TRUE(s21_moved == source);
+  EXPECT_TRUE(s21_copy.Empty());
+}
+
+TEST(CountedMultiSet, T0Strings) {
+  s21::CountedMultiSet<std::string> s21_multiset;
+  std::multiset<std::string> multiset;
+  for (int i = 0; i < 50; ++i) {
+    const std::string word(static_cast<std::size_t>(i % 5 + 20), 'a' + i % 3);
+    s21_multiset.Insert(word);
+    multiset.insert(word);
+  }
+
+  EXPECT_TRUE(s21_multiset == multiset);
+  EXPECT_EQ(s21_multiset.Erase(std::string(20, 'a')),
+            multiset.erase(std::string(20, 'a')));
+  EXPECT_TRUE(s21_multiset == multiset);
+}
+
+}  // namespace
+
+// GCOVR_EXCL_STOP
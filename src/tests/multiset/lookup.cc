@@ -887,6 +887,27 @@ TEST(Set, T8EqualRange) {
   // static_assert(0 && "??");
 }
 
+TEST(MultiSet, T0Count) {
+  s21::MultiSet<Item, ComparatorItem> s21_multiset{
+      Item(4, 'a'), Item(4, 'b'), Item(2), Item(4, 'c'), Item(7), Item(2)};
+  std::multiset<Item, ComparatorItem> multiset{
+      Item(4, 'a'), Item(4, 'b'), Item(2), Item(4, 'c'), Item(7), Item(2)};
+
+  for (int key = 0; key < 9; ++key)
+    EXPECT_EQ(s21_multiset.Count(Item(key)), multiset.count(Item(key)));
+}
+
+TEST(MultiSet, T0EraseKey) {
+  s21::MultiSet<Item, ComparatorItem> s21_multiset{
+      Item(4, 'a'), Item(4, 'b'), Item(2), Item(4, 'c'), Item(7), Item(2)};
+  std::multiset<Item, ComparatorItem> multiset{
+      Item(4, 'a'), Item(4, 'b'), Item(2), Item(4, 'c'), Item(7), Item(2)};
+
+  EXPECT_EQ(s21_multiset.Erase(Item(4)), multiset.erase(Item(4)));
+  EXPECT_EQ(s21_multiset.Erase(Item(5)), multiset.erase(Item(5)));
+  EXPECT_EQ(s21_multiset, multiset);
+}
+
 }  // namespace
 
 // GCOVR_EXCL_STOP
\ No newline at end of file
@@ -129,6 +129,56 @@ TEST(MultiSet, T1ClearEmpty) {
   EXPECT_EQ(s21_multiset, multiset);
 }
 
+TEST(MultiSet, T0Emplace) {
+  s21::MultiSet<Item, ComparatorItem> s21_multiset;
+  std::multiset<Item, ComparatorItem> multiset;
+  for (int i = 0; i < 20; ++i) {
+    auto s21_it = s21_multiset.Emplace(i % 4, 'b');
+    multiset.emplace(i % 4, 'b');
+    EXPECT_EQ(*s21_it, Item(i % 4, 'b'));
+  }
+  EXPECT_EQ(s21_multiset, multiset);
+}
+
+TEST(MultiSet, T0EmplaceHint) {
+  s21::MultiSet<Item, ComparatorItem> s21_multiset;
+  std::multiset<Item, ComparatorItem> multiset;
+  for (int i = 0; i < 20; ++i) {
+    s21_multiset.Emplace_hint(s21_multiset.cend(), i / 4);
+    multiset.emplace_hint(multiset.cend(), i / 4);
+  }
+  s21_multiset.Emplace_hint(s21_multiset.cbegin(), 3);
+  multiset.emplace_hint(multiset.cbegin(), 3);
+  EXPECT_EQ(s21_multiset, multiset);
+}
+
+TEST(MultiSet, T0InsertManyUnsorted) {
+  s21::MultiSet<Item, ComparatorItem> s21_multiset{Item(2)};
+  auto s21_result =
+      s21_multiset.Insert_many(Item(7), Item(2), Item(-1), Item(7), Item(2));
+
+  std::multiset<Item, ComparatorItem> multiset{Item(2), Item(7), Item(2), Item(-1), Item(7),
+                               Item(2)};
+  EXPECT_EQ(s21_multiset, multiset);
+
+  const int numbers[] = {7, 2, -1, 7, 2};
+  ASSERT_EQ(s21_result.Size(), 5ull);
+  for (int i = 0; i < 5; ++i) EXPECT_EQ(*s21_result[i].first, Item(numbers[i]));
+  EXPECT_EQ(s21_result[1].first, ++s21_multiset.Find(Item(2)));
+}
+
+TEST(CountedMultiSet, T0EmplaceInsertMany) {
+  s21::CountedMultiSet<int> s21_multiset;
+  std::multiset<int> multiset;
+  s21_multiset.Emplace(3);
+  s21_multiset.Emplace_hint(s21_multiset.cend(), 3);
+  s21_multiset.Emplace_hint(s21_multiset.cend(), 4);
+  s21_multiset.Insert_many(4, 1, 3, 1);
+  multiset.insert({3, 3, 4, 4, 1, 3, 1});
+  EXPECT_TRUE(s21_multiset == multiset);
+  EXPECT_EQ(s21_multiset.Count(3), 3ull);
+}
+
 }  // namespace
 
 // GCOVR_EXCL_STOP
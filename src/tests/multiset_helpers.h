@@ -26,6 +26,24 @@ bool operator==(const s21::MultiSet<Type, Comparator>& s21_multiset,
   return true;
 }
 
+template <typename Type, typename S21Comparator, typename Comparator>
+bool operator==(const s21::CountedMultiSet<Type, S21Comparator>& s21_multiset,
+                const std::multiset<Type, Comparator>& multiset) {
+  if (s21_multiset.Size() != multiset.size()) return false;
+
+  auto s21_it = s21_multiset.cbegin();
+  auto it = multiset.cbegin();
+
+  while (s21_it != s21_multiset.cend()) {
+    if (*s21_it != *it) return false;
+
+    ++s21_it;
+    ++it;
+  }
+
+  return true;
+}
+
 template <typename Type, typename Comparator>
 std::ostream& operator<<(std::ostream& out,
                          const s21::MultiSet<Type, Comparator>& s21_map) {
@@ -6,6 +6,7 @@
 #include <vector>
 
 #include "../../s21_queue.h"
+#include "../allocator.h"
 #include "../item.h"
 #include "../queue_helpers.h"
 
@@ -105,5 +106,24 @@ TEST(Queue, T8ConstructorIterator) {
   EXPECT_TRUE(s21_queue == queue);
 }
 
+TEST(Queue, T9ConstructorAllocator) {
+  using CountingList = s21::List<Item, CountingAllocator<Item>>;
+  AllocationStatistics statistics;
+  const CountingAllocator<Item> allocator(&statistics);
+  {
+    const CountingList source{Item(11), Item(22), Item(33)};
+    s21::Queue<Item, CountingList> s21_queue(source, allocator);
+    s21::Queue<Item, CountingList> s21_moved(std::move(s21_queue), allocator);
+    s21::Queue<Item, CountingList> s21_empty(allocator);
+    s21_empty.Push(Item(44));
+
+    std::list<Item> list{Item(11), Item(22), Item(33)};
+    std::queue<Item, std::list<Item>> queue(list);
+    EXPECT_EQ(statistics.allocations, 4ull);
+    EXPECT_TRUE(s21_moved == queue);
+  }
+  EXPECT_EQ(statistics.allocated, 0ull);
+}
+
 }  // namespace
    // GCOVR_EXCL_STOP
@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "../../s21_segmented_vector.h"
+#include "../allocator.h"
+#include "../item.h"
+#include "../segmented_vector_helpers.h"
+
+// GCOVR_EXCL_START
+
+namespace {
+
+TEST(SegmentedVector, T0DefaultConstructor) {
+  const s21::SegmentedVector<Item> s21_vector;
+
+  EXPECT_TRUE(s21_vector.Empty());
+  EXPECT_EQ(s21_vector.Size(), 0ull);
+  EXPECT_EQ(s21_vector.Capacity(), 0ull);
+  EXPECT_TRUE(s21_vector.begin() == s21_vector.end());
+}
+
+TEST(SegmentedVector, T0ConstructorInitializerList) {
+  const s21::SegmentedVector<Item, 2> s21_vector{Item(1), Item(2), Item(3),
+                                                  Item(4), Item(5)};
+  const std::vector<Item> vector{Item(1), Item(2), Item(3), Item(4), Item(5)};
+
+  EXPECT_EQ(s21_vector, vector);
+  EXPECT_EQ(s21_vector.Capacity(), 6ull);  // 2 + 4
+}
+
+TEST(SegmentedVector, T0ConstructorCountValue) {
+  const s21::SegmentedVector<Item, 4> s21_vector(30ull, Item(7));
+  const std::vector<Item> vector(30ull, Item(7));
+
+  EXPECT_EQ(s21_vector, vector);
+  EXPECT_EQ(s21_vector.Capacity(), 60ull);  // 4 + 8 + 16 + 32
+}
+
+TEST(SegmentedVector, T0CopyConstructor) {
+  const s21::SegmentedVector<Item, 2> s21_vector{Item(1), Item(2), Item(3)};
+  const s21::SegmentedVector<Item, 2> s21_copy(s21_vector);
+
+  EXPECT_EQ(s21_copy, s21_vector);
+  EXPECT_EQ(s21_copy, std::vector<Item>({Item(1), Item(2), Item(3)}));
+}
+
+TEST(SegmentedVector, T0MoveConstructor) {
+  s21::SegmentedVector<Item, 2> s21_vector{Item(1), Item(2), Item(3)};
+  const Item* const address = &s21_vector[2];
+
+  const s21::SegmentedVector<Item, 2> s21_moved(std::move(s21_vector));
+
+  EXPECT_EQ(s21_moved, std::vector<Item>({Item(1), Item(2), Item(3)}));
+  EXPECT_EQ(&s21_moved[2], address);  // the blocks are taken as they are
+  EXPECT_TRUE(s21_vector.Empty());
+}
+
+TEST(SegmentedVector, T0CopyAssignment) {
+  const s21::SegmentedVector<Item, 2> s21_vector{Item(1), Item(2), Item(3)};
+  s21::SegmentedVector<Item, 2> s21_other{Item(4)};
+
+  s21_other = s21_vector;
+
+  EXPECT_EQ(s21_other, s21_vector);
+}
+
+TEST(SegmentedVector, T0MoveAssignment) {
+  s21::SegmentedVector<Item, 2> s21_vector{Item(1), Item(2), Item(3)};
+  s21::SegmentedVector<Item, 2> s21_other{Item(4), Item(5), Item(6), Item(7),
+                                          Item(8), Item(9), Item(10)};
+
+  s21_other = std::move(s21_vector);
+
+  EXPECT_EQ(s21_other, std::vector<Item>({Item(1), Item(2), Item(3)}));
+  EXPECT_TRUE(s21_vector.Empty());
+}
+
+TEST(SegmentedVector, T0Allocator) {
+  AllocationStatistics statistics;
+  {
+    s21::SegmentedVector<Item, 16, CountingAllocator<Item>> s21_vector{
+        CountingAllocator<Item>(&statistics)};
+    for (int i = 0; i < 1000; ++i) s21_vector.Push_back(Item(i));
+
+    // one allocation per block: 16, 32 ... 512
+    EXPECT_EQ(statistics.allocations, 6ull);
+    EXPECT_EQ(statistics.deallocations, 0ull);
+    EXPECT_EQ(statistics.allocated, s21_vector.Capacity());
+  }
+  EXPECT_EQ(statistics.deallocations, statistics.allocations);
+  EXPECT_EQ(statistics.allocated, 0ull);
+}
+
+}  // namespace
+
+// GCOVR_EXCL_STOP
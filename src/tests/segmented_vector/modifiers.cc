@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../../s21_segmented_vector.h"
+#include "../item.h"
+#include "../segmented_vector_helpers.h"
+
+// GCOVR_EXCL_START
+
+namespace {
+
+TEST(SegmentedVector, T0PushBack) {
+  s21::SegmentedVector<int, 4> s21_vector;
+  std::vector<int> vector;
+  for (int i = 0; i < 1000; ++i) {
+    s21_vector.Push_back(i);
+    vector.push_back(i);
+  }
+
+  EXPECT_TRUE(s21_vector == vector);
+  EXPECT_EQ(s21_vector.Front(), 0);
+  EXPECT_EQ(s21_vector.Back(), 999);
+  for (std::size_t i = 0ull; i < vector.size(); ++i)
+    EXPECT_EQ(s21_vector[i], vector[i]);
+}
+
+TEST(SegmentedVector, T0ElementsNeverMove) {
+  s21::SegmentedVector<std::string, 1> s21_vector;
+  std::vector<const std::string*> addresses;
+  for (int i = 0; i < 300; ++i) {
+    addresses.push_back(&s21_vector.Emplace_back(std::to_string(i)));
+    s21_vector.Shrink_to_fit();
+  }
+
+  for (std::size_t i = 0ull; i < addresses.size(); ++i) {
+    EXPECT_EQ(&s21_vector[i], addresses[i]);
+    EXPECT_EQ(*addresses[i], std::to_string(i));
+  }
+}
+
+TEST(SegmentedVector, T0IteratorsStayValid) {
+  s21::SegmentedVector<Item, 2> s21_vector{Item(1), Item(2), Item(3)};
+  const auto it = s21_vector.begin() + 2;
+  for (int i = 4; i < 100; ++i) s21_vector.Push_back(Item(i));
+
+  EXPECT_EQ(*it, Item(3));
+  EXPECT_EQ(it->number(), 3);
+}
+
+TEST(SegmentedVector, T0RandomAccessIterator) {
+  s21::SegmentedVector<int, 2> s21_vector;
+  for (int i = 0; i < 100; ++i) s21_vector.Push_back(99 - i);
+
+  std::sort(s21_vector.begin(), s21_vector.end());
+  EXPECT_TRUE(std::is_sorted(s21_vector.cbegin(), s21_vector.cend()));
+
+  const auto found =
+      std::lower_bound(s21_vector.cbegin(), s21_vector.cend(), 42);
+  EXPECT_EQ(found - s21_vector.cbegin(), 42);
+  EXPECT_EQ(found[5], 47);
+  EXPECT_TRUE(found < s21_vector.end());
+  EXPECT_TRUE(s21_vector.end() - s21_vector.begin() == 100);
+}
+
+TEST(SegmentedVector, T0At) {
+  s21::SegmentedVector<Item> s21_vector{Item(1), Item(2)};
+
+  EXPECT_EQ(s21_vector.At(1ull), Item(2));
+  EXPECT_THROW(s21_vector.At(2ull), std::out_of_range);
+}
+
+TEST(SegmentedVector, T0PopBack) {
+  s21::SegmentedVector<Item, 2> s21_vector{Item(1), Item(2), Item(3)};
+  s21_vector.Pop_back();
+  s21_vector.Pop_back();
+
+  EXPECT_EQ(s21_vector, std::vector<Item>({Item(1)}));
+  EXPECT_EQ(s21_vector.Capacity(), 6ull);
+
+  s21_vector.Shrink_to_fit();
+  EXPECT_EQ(s21_vector.Capacity(), 2ull);
+  EXPECT_EQ(s21_vector, std::vector<Item>({Item(1)}));
+}
+
+TEST(SegmentedVector, T0Reserve) {
+  s21::SegmentedVector<Item, 4> s21_vector;
+  s21_vector.Reserve(20ull);
+
+  EXPECT_EQ(s21_vector.Capacity(), 28ull);  // 4 + 8 + 16
+  EXPECT_TRUE(s21_vector.Empty());
+}
+
+TEST(SegmentedVector, T0ClearSwap) {
+  s21::SegmentedVector<Item, 2> s21_vector{Item(1), Item(2), Item(3)};
+  s21::SegmentedVector<Item, 2> s21_other{Item(4)};
+
+  s21_vector.Swap(s21_other);
+  EXPECT_EQ(s21_vector, std::vector<Item>({Item(4)}));
+  EXPECT_EQ(s21_other, std::vector<Item>({Item(1), Item(2), Item(3)}));
+
+  s21_other.Clear();
+  EXPECT_TRUE(s21_other.Empty());
+  EXPECT_EQ(s21_other.Capacity(), 0ull);
+}
+
+TEST(SegmentedVector, T0ConcurrentReaders) {
+  constexpr std::size_t kCount = 100000ull;
+  s21::SegmentedVector<std::size_t, 4> s21_vector;
+  std::atomic<bool> done{false};
+  std::atomic<std::size_t> mismatches{0ull};
+
+  // every element below Size() is already constructed when it is seen
+  auto reader = [&] {
+    std::size_t checked = 0ull;
+    while (!done.load(std::memory_order_acquire) || checked < kCount) {
+      const std::size_t size = s21_vector.Size();
+      for (; checked < size; ++checked)
+        if (s21_vector[checked] != checked * 3ull) ++mismatches;
+    }
+  };
+  std::thread first(reader);
+  std::thread second(reader);
+
+  for (std::size_t i = 0ull; i < kCount; ++i) s21_vector.Push_back(i * 3ull);
+  done.store(true, std::memory_order_release);
+
+  first.join();
+  second.join();
+  EXPECT_EQ(mismatches.load(), 0ull);
+  EXPECT_EQ(s21_vector.Size(), kCount);
+}
+
+}  // namespace
+
+// GCOVR_EXCL_STOP
@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "../../s21_array.h"
+#include "../../s21_simd.h"
+#include "../../s21_vector.h"
+
+// GCOVR_EXCL_START
+
+namespace {
+
+const s21::simd::Level kLevels[] = {
+    s21::simd::Level::kScalar, s21::simd::Level::kSse2,
+    s21::simd::Level::kAvx2, s21::simd::Level::kAvx512};
+
+// sizes around the block of the widest register, with and without the tail
+const std::size_t kSizes[] = {1ull,  2ull,   15ull,  16ull,  17ull,
+                              63ull, 64ull,  65ull,  200ull, 1000ull};
+
+// every kernel is checked with every level the CPU has
+class Simd : public ::testing::TestWithParam<s21::simd::Level> {
+ protected:
+  void SetUp() override { s21::simd::Set_level(GetParam()); }
+  void TearDown() override {
+    s21::simd::Set_level(s21::simd::Detected());
+  }
+};
+
+template <typename Type>
+s21::Vector<Type> random_vector(std::size_t size, unsigned seed) {
+  std::mt19937 generator(seed);
+  std::uniform_int_distribution<int> distribution(-50, 50);
+  s21::Vector<Type> result;
+  for (std::size_t i = 0ull; i < size; ++i)
+    result.Push_back(static_cast<Type>(distribution(generator)));
+  return result;
+}
+
+TEST_P(Simd, T0FindCount) {
+  for (std::size_t size : kSizes) {
+    const auto s21_vector = random_vector<std::int32_t>(size, 1u);
+    const std::vector<std::int32_t> vector(s21_vector.cbegin(),
+                                           s21_vector.cend());
+    for (std::int32_t value : {-50, 0, 7, 100}) {
+      const auto found = std::find(vector.cbegin(), vector.cend(), value);
+      EXPECT_EQ(s21::simd::Find(s21_vector, value),
+                static_cast<std::size_t>(found - vector.cbegin()));
+      EXPECT_EQ(s21::simd::Count(s21_vector, value),
+                static_cast<std::size_t>(
+                    std::count(vector.cbegin(), vector.cend(), value)));
+    }
+  }
+}
+
+TEST_P(Simd, T0FindBytes) {
+  std::vector<unsigned char> bytes(300ull, 'a');
+  bytes[257] = 'z';
+
+  EXPECT_EQ(s21::simd::Find(bytes.data(), bytes.size(), (unsigned char)'z'),
+            257ull);
+  EXPECT_EQ(s21::simd::Find(bytes.data(), bytes.size(), (unsigned char)'q'),
+            300ull);
+  EXPECT_EQ(s21::simd::Find(bytes.data(), 0ull, (unsigned char)'a'), 0ull);
+}
+
+TEST_P(Simd, T0SumDotIntegers) {
+  for (std::size_t size : kSizes) {
+    const auto left = random_vector<std::int32_t>(size, 2u);
+    const auto right = random_vector<std::int32_t>(size, 3u);
+    std::int64_t sum = 0;
+    std::int64_t dot = 0;
+    for (std::size_t i = 0ull; i < size; ++i) {
+      sum += left[i];
+      dot += std::int64_t(left[i]) * right[i];
+    }
+
+    EXPECT_EQ(s21::simd::Sum(left), sum);
+    EXPECT_EQ(s21::simd::Dot(left, right), dot);
+  }
+}
+
+TEST_P(Simd, T0SumIntegersDoNotOverflow) {
+  const s21::Vector<std::int32_t> s21_vector(1000ull, 2000000000);
+
+  EXPECT_EQ(s21::simd::Sum(s21_vector), 2000000000000ll);
+}
+
+TEST_P(Simd, T0SumDotFloating) {
+  for (std::size_t size : kSizes) {
+    const auto left = random_vector<double>(size, 4u);
+    const auto right = random_vector<float>(size, 5u);
+    const double sum = std::accumulate(left.cbegin(), left.cend(), 0.0);
+    const float dot = std::inner_product(right.cbegin(), right.cend(),
+                                         right.cbegin(), 0.0f);
+
+    // small integers: exact in any order of additions
+    EXPECT_DOUBLE_EQ(s21::simd::Sum(left), sum);
+    EXPECT_FLOAT_EQ(s21::simd::Dot(right, right), dot);
+  }
+}
+
+TEST_P(Simd, T0MinMax) {
+  for (std::size_t size : kSizes) {
+    const auto s21_vector = random_vector<float>(size, 6u);
+    const std::vector<float> vector(s21_vector.cbegin(), s21_vector.cend());
+    const auto [minimum, maximum] =
+        std::minmax_element(vector.cbegin(), vector.cend());
+
+    EXPECT_EQ(s21::simd::Min(s21_vector), *minimum);
+    EXPECT_EQ(s21::simd::Max(s21_vector), *maximum);
+  }
+
+  const s21::Array<std::int16_t, 5> s21_array{3, -7, 12, 0, 5};
+  EXPECT_EQ(s21::simd::Min(s21_array), -7);
+  EXPECT_EQ(s21::simd::Max(s21_array), 12);
+}
+
+TEST_P(Simd, T0Mismatch) {
+  for (std::size_t size : kSizes) {
+    const auto left = random_vector<std::uint64_t>(size, 7u);
+    auto right = left;
+    EXPECT_TRUE(s21::simd::Equal(left, right));
+
+    right[size - 1ull] += 1ull;
+    right[size / 2ull] += 1ull;
+    EXPECT_EQ(s21::simd::Mismatch(left.Data(), right.Data(), size),
+              size / 2ull);
+    EXPECT_FALSE(s21::simd::Equal(left, right));
+  }
+}
+
+TEST(SimdLevel, T0SetLevel) {
+  s21::simd::Set_level(s21::simd::Level::kAvx512);
+  EXPECT_EQ(s21::simd::Active(), s21::simd::Detected());
+
+  s21::simd::Set_level(s21::simd::Level::kScalar);
+  EXPECT_EQ(s21::simd::Active(), s21::simd::Level::kScalar);
+  s21::simd::Set_level(s21::simd::Detected());
+}
+
+INSTANTIATE_TEST_SUITE_P(Levels, Simd, ::testing::ValuesIn(kLevels));
+
+}  // namespace
+
+// GCOVR_EXCL_STOP
@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+
+#include <list>
+#include <vector>
+
+#include "../../s21_small_vector.h"
+#include "../allocator.h"
+#include "../item.h"
+#include "../small_vector_helpers.h"
+
+// GCOVR_EXCL_START
+
+namespace {
+
+TEST(SmallVector, T0DefaultConstructor) {
+  const s21::SmallVector<Item, 4> s21_vector;
+
+  EXPECT_TRUE(s21_vector.Empty());
+  EXPECT_TRUE(s21_vector.Inline());
+  EXPECT_EQ(s21_vector.Capacity(), 4ull);
+  EXPECT_EQ(s21_vector.Capacity_waste(), 0ull);
+}
+
+TEST(SmallVector, T0ConstructorInitializerList) {
+  const s21::SmallVector<Item, 4> s21_vector{Item(1), Item(2), Item(3)};
+  const std::vector<Item> vector{Item(1), Item(2), Item(3)};
+
+  EXPECT_EQ(s21_vector, vector);
+  EXPECT_TRUE(s21_vector.Inline());
+}
+
+TEST(SmallVector, T1ConstructorInitializerList) {
+  const s21::SmallVector<Item, 2> s21_vector{Item(1), Item(2), Item(3)};
+  const std::vector<Item> vector{Item(1), Item(2), Item(3)};
+
+  EXPECT_EQ(s21_vector, vector);
+  EXPECT_FALSE(s21_vector.Inline());
+  EXPECT_EQ(s21_vector.Capacity(), 3ull);
+}
+
+TEST(SmallVector, T0ConstructorCountValue) {
+  const s21::SmallVector<Item, 4> s21_vector(6ull, Item(7));
+  const std::vector<Item> vector(6ull, Item(7));
+
+  EXPECT_EQ(s21_vector, vector);
+}
+
+TEST(SmallVector, T0ConstructorIterators) {
+  const std::list<Item> list{Item(1), Item(2), Item(3), Item(4), Item(5)};
+  const s21::SmallVector<Item, 8> s21_vector(list.cbegin(), list.cend());
+  const std::vector<Item> vector(list.cbegin(), list.cend());
+
+  EXPECT_EQ(s21_vector, vector);
+}
+
+TEST(SmallVector, T0CopyConstructor) {
+  const s21::SmallVector<Item, 2> s21_inline{Item(1), Item(2)};
+  const s21::SmallVector<Item, 2> s21_spilled{Item(1), Item(2), Item(3)};
+
+  const s21::SmallVector<Item, 2> s21_inline_copy(s21_inline);
+  const s21::SmallVector<Item, 2> s21_spilled_copy(s21_spilled);
+
+  EXPECT_TRUE(s21_inline_copy == s21_inline);
+  EXPECT_TRUE(s21_spilled_copy == s21_spilled);
+}
+
+TEST(SmallVector, T0MoveConstructor) {
+  s21::SmallVector<Item, 2> s21_inline{Item(1), Item(2)};
+  s21::SmallVector<Item, 2> s21_spilled{Item(1), Item(2), Item(3)};
+  const Item* spilled_data = s21_spilled.Data();
+
+  const s21::SmallVector<Item, 2> s21_inline_moved(std::move(s21_inline));
+  const s21::SmallVector<Item, 2> s21_spilled_moved(std::move(s21_spilled));
+
+  EXPECT_EQ(s21_inline_moved, std::vector<Item>({Item(1), Item(2)}));
+  EXPECT_TRUE(s21_inline_moved.Inline());
+  // the allocated chunk changes hands
+  EXPECT_EQ(s21_spilled_moved.Data(), spilled_data);
+  EXPECT_TRUE(s21_inline.Empty());
+  EXPECT_TRUE(s21_spilled.Empty());
+  EXPECT_TRUE(s21_spilled.Inline());
+}
+
+TEST(SmallVector, T0Assignment) {
+  const s21::SmallVector<Item, 2> s21_spilled{Item(1), Item(2), Item(3)};
+  s21::SmallVector<Item, 2> s21_vector{Item(4)};
+
+  s21_vector = s21_spilled;
+  EXPECT_TRUE(s21_vector == s21_spilled);
+
+  s21_vector = s21::SmallVector<Item, 2>{Item(5)};
+  EXPECT_EQ(s21_vector, std::vector<Item>({Item(5)}));
+  EXPECT_TRUE(s21_vector.Inline());
+
+  s21_vector.Assign({Item(6), Item(7), Item(8)});
+  EXPECT_EQ(s21_vector, std::vector<Item>({Item(6), Item(7), Item(8)}));
+}
+
+// the point of it: no allocations while the elements fit inline
+TEST(SmallVector, T0AllocationsAvoided) {
+  AllocationStatistics statistics;
+  {
+    using CountingSmallVector =
+        s21::SmallVector<Item, 8, s21::Growth::PowerOfTwo,
+                         CountingAllocator<Item>>;
+    for (int i = 0; i < 100; ++i) {
+      CountingSmallVector s21_vector{CountingAllocator<Item>(&statistics)};
+      for (int j = 0; j < 8; ++j) s21_vector.Push_back(Item(j));
+      CountingSmallVector s21_copy(s21_vector);
+      s21_vector.Swap(s21_copy);
+    }
+    EXPECT_EQ(statistics.allocations, 0ull);
+
+    CountingSmallVector s21_vector{CountingAllocator<Item>(&statistics)};
+    for (int j = 0; j < 9; ++j) s21_vector.Push_back(Item(j));
+    EXPECT_EQ(statistics.allocations, 1ull);
+  }
+  EXPECT_EQ(statistics.deallocations, 1ull);
+}
+
+}  // namespace
+
+// GCOVR_EXCL_STOP
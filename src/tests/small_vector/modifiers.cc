@@ -0,0 +1,201 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "../../s21_small_vector.h"
+#include "../allocator.h"
+#include "../counter.h"
+#include "../item.h"
+#include "../small_vector_helpers.h"
+
+// GCOVR_EXCL_START
+
+namespace {
+
+TEST(SmallVector, T0PushBackSpills) {
+  s21::SmallVector<Item, 3> s21_vector;
+  std::vector<Item> vector;
+
+  for (int i = 0; i < 10; ++i) {
+    s21_vector.Push_back(Item(i));
+    vector.push_back(Item(i));
+    EXPECT_EQ(s21_vector.Inline(), i < 3);
+  }
+
+  EXPECT_EQ(s21_vector, vector);
+  EXPECT_GE(s21_vector.Capacity(), 10ull);
+}
+
+TEST(SmallVector, T0EmplaceBackOwnElement) {
+  s21::SmallVector<Item, 2> s21_vector{Item(1), Item(2)};
+
+  s21_vector.Emplace_back(s21_vector.Front());
+  s21_vector.Push_back(s21_vector[1]);
+
+  EXPECT_EQ(s21_vector,
+            std::vector<Item>({Item(1), Item(2), Item(1), Item(2)}));
+}
+
+TEST(SmallVector, T0Insert) {
+  s21::SmallVector<Item, 4> s21_vector{Item(1), Item(4)};
+  std::vector<Item> vector{Item(1), Item(4)};
+
+  auto s21_it = s21_vector.Insert(s21_vector.cbegin() + 1, Item(3));
+  auto it = vector.insert(vector.cbegin() + 1, Item(3));
+  EXPECT_EQ(*s21_it, *it);
+
+  s21_it = s21_vector.Insert(s21_vector.cbegin() + 1, {Item(2), Item(2)});
+  it = vector.insert(vector.cbegin() + 1, {Item(2), Item(2)});
+  EXPECT_EQ(*s21_it, *it);
+
+  s21_it = s21_vector.Insert(s21_vector.cend(), 3ull, Item(5));
+  it = vector.insert(vector.cend(), 3ull, Item(5));
+  EXPECT_EQ(*s21_it, *it);
+
+  EXPECT_EQ(s21_vector, vector);
+}
+
+TEST(SmallVector, T0InsertMany) {
+  s21::SmallVector<Item, 4> s21_vector{Item(1), Item(5)};
+
+  auto s21_it =
+      s21_vector.Insert_many(s21_vector.cbegin() + 1, Item(2), Item(3), Item(4));
+  s21_vector.Insert_many_back(Item(6), Item(7));
+
+  EXPECT_EQ(*s21_it, Item(5));
+  EXPECT_EQ(s21_vector, std::vector<Item>({Item(1), Item(2), Item(3), Item(4),
+                                           Item(5), Item(6), Item(7)}));
+}
+
+TEST(SmallVector, T0InsertManyRelocatesTailOnce) {
+  s21::SmallVector<Counter, 16> s21_vector;
+  for (int i = 0; i < 10; ++i) s21_vector.Emplace_back(i);
+  Counter::Reset();
+
+  s21_vector.Insert_many(s21_vector.cbegin() + 5, Counter(-1), Counter(-2),
+                         Counter(-3));
+
+  // the tail of 5 is moved once and the arguments are moved into place
+  EXPECT_EQ(Counter::moves, 5ull + 3ull);
+  EXPECT_EQ(Counter::copies, 0ull);
+  EXPECT_EQ(s21_vector[5ull], Counter(-1));
+  EXPECT_EQ(s21_vector[8ull], Counter(5));
+}
+
+TEST(SmallVector, T0InsertManyBackGrowsOnce) {
+  AllocationStatistics statistics;
+  s21::SmallVector<int, 2, s21::Growth::Exact, CountingAllocator<int>>
+      s21_vector({1}, CountingAllocator<int>(&statistics));
+
+  s21_vector.Insert_many_back(2, 3, 4, 5, 6);
+
+  EXPECT_EQ(statistics.allocations, 1ull);
+  EXPECT_EQ(s21_vector.Capacity(), 6ull);
+  EXPECT_EQ(s21_vector, std::vector<int>({1, 2, 3, 4, 5, 6}));
+}
+
+TEST(SmallVector, T0InsertOwnElement) {
+  const std::string a(32, 'a');
+  const std::string b(32, 'b');
+  const std::string c(32, 'c');
+  s21::SmallVector<std::string, 16> s21_vector{a, b, c};
+
+  // the arguments are elements of the tail which moves to make room
+  s21_vector.Insert(s21_vector.cbegin(), s21_vector[1ull]);
+  s21_vector.Insert(s21_vector.cbegin() + 1, 2ull, s21_vector[3ull]);
+  s21_vector.Emplace(s21_vector.cbegin(), s21_vector[2ull]);
+  s21_vector.Insert_many(s21_vector.cbegin(), s21_vector[1ull], a);
+
+  const std::vector<std::string> vector{b, a, c, b, c, c, a, b, c};
+  EXPECT_TRUE(s21_vector.Inline());
+  EXPECT_TRUE(std::equal(s21_vector.cbegin(), s21_vector.cend(),
+                         vector.cbegin(), vector.cend()));
+}
+
+TEST(SmallVector, T0ResizeValueInitialized) {
+  s21::SmallVector<int, 2> s21_vector{1, 2};
+
+  s21_vector.Resize(5ull);
+
+  EXPECT_TRUE(std::equal(s21_vector.cbegin(), s21_vector.cend(),
+                         std::vector<int>({1, 2, 0, 0, 0}).cbegin()));
+  EXPECT_EQ(s21_vector.Size(), 5ull);
+}
+
+TEST(SmallVector, T0Erase) {
+  s21::SmallVector<Item, 2> s21_vector{Item(1), Item(2), Item(3), Item(4)};
+  std::vector<Item> vector{Item(1), Item(2), Item(3), Item(4)};
+
+  auto s21_it = s21_vector.Erase(s21_vector.cbegin() + 1);
+  auto it = vector.erase(vector.cbegin() + 1);
+  EXPECT_EQ(*s21_it, *it);
+
+  s21_it = s21_vector.Erase(s21_vector.cbegin(), s21_vector.cbegin() + 2);
+  it = vector.erase(vector.cbegin(), vector.cbegin() + 2);
+  EXPECT_EQ(*s21_it, *it);
+
+  EXPECT_EQ(s21_vector, vector);
+}
+
+TEST(SmallVector, T0ShrinkToFitGetsInline) {
+  s21::SmallVector<Item, 2> s21_vector{Item(1), Item(2), Item(3), Item(4)};
+
+  s21_vector.Pop_back();
+  s21_vector.Pop_back();
+  s21_vector.Shrink_to_fit();
+
+  EXPECT_TRUE(s21_vector.Inline());
+  EXPECT_EQ(s21_vector.Capacity(), 2ull);
+  EXPECT_EQ(s21_vector, std::vector<Item>({Item(1), Item(2)}));
+}
+
+TEST(SmallVector, T0ReserveAndResize) {
+  s21::SmallVector<Item, 2> s21_vector{Item(1)};
+  std::vector<Item> vector{Item(1)};
+
+  s21_vector.Reserve(10ull);
+  EXPECT_EQ(s21_vector.Capacity(), 10ull);
+  EXPECT_EQ(s21_vector.Capacity_waste(), 9ull * sizeof(Item));
+
+  s21_vector.Resize(5ull, Item(9));
+  vector.resize(5ull, Item(9));
+  EXPECT_EQ(s21_vector, vector);
+
+  s21_vector.Resize(2ull);
+  vector.resize(2ull);
+  EXPECT_EQ(s21_vector, vector);
+}
+
+TEST(SmallVector, T0Swap) {
+  s21::SmallVector<Item, 2> s21_inline{Item(1)};
+  s21::SmallVector<Item, 2> s21_spilled{Item(2), Item(3), Item(4)};
+  s21::SmallVector<Item, 2> s21_other{Item(5), Item(6), Item(7)};
+
+  s21_inline.Swap(s21_spilled);
+  EXPECT_EQ(s21_inline, std::vector<Item>({Item(2), Item(3), Item(4)}));
+  EXPECT_EQ(s21_spilled, std::vector<Item>({Item(1)}));
+  EXPECT_TRUE(s21_spilled.Inline());
+
+  s21_inline.Swap(s21_other);
+  EXPECT_EQ(s21_inline, std::vector<Item>({Item(5), Item(6), Item(7)}));
+  EXPECT_EQ(s21_other, std::vector<Item>({Item(2), Item(3), Item(4)}));
+}
+
+TEST(SmallVector, T0Iterators) {
+  s21::SmallVector<int, 4> s21_vector{1, 2, 3};
+
+  int sum = 0;
+  for (auto it = s21_vector.cbegin(); it != s21_vector.cend(); ++it) sum += *it;
+  for (auto it = s21_vector.rbegin(); it != s21_vector.rend(); ++it) *it *= 2;
+
+  EXPECT_EQ(sum, 6);
+  EXPECT_EQ(s21_vector.At(2ull), 6);
+  EXPECT_EQ(s21_vector.end() - s21_vector.begin(), 3);
+  EXPECT_THROW(s21_vector.At(3ull), std::out_of_range);
+}
+
+}  // namespace
+
+// GCOVR_EXCL_STOP
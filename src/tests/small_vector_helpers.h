@@ -0,0 +1,43 @@
+#ifndef _TESTS_SMALL_VECTOR_HELPERS_H_
+#define _TESTS_SMALL_VECTOR_HELPERS_H_
+
+#include <iostream>
+#include <vector>
+
+#include "../s21_small_vector.h"
+
+// GCOVR_EXCL_START
+
+template <typename Type, std::size_t N, typename... Parameters>
+bool operator==(const s21::SmallVector<Type, N, Parameters...>& s21_vector,
+                const std::vector<Type>& vector) {
+  if (s21_vector.Size() != vector.size()) return false;
+
+  auto s21_it = s21_vector.cbegin();
+  auto it = vector.cbegin();
+  while (s21_it != s21_vector.cend()) {
+    if (*s21_it != *it) return false;
+    ++s21_it;
+    ++it;
+  }
+
+  return true;
+}
+
+template <typename Type, std::size_t N, typename... Parameters>
+bool operator!=(const s21::SmallVector<Type, N, Parameters...>& s21_vector,
+                const std::vector<Type>& vector) {
+  return !(s21_vector == vector);
+}
+
+template <typename Type, std::size_t N, typename... Parameters>
+std::ostream& operator<<(
+    std::ostream& out, const s21::SmallVector<Type, N, Parameters...>& object) {
+  out << "SmallVector: ";
+  for (const auto& element : object) out << element << ' ';
+  return out;
+}
+
+// GCOVR_EXCL_STOP
+
+#endif  //  _TESTS_SMALL_VECTOR_HELPERS_H_
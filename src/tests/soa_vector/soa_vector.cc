@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../../s21_soa_vector.h"
+#include "../item.h"
+
+// GCOVR_EXCL_START
+
+namespace {
+
+struct Particle {
+  std::int64_t id;
+  float x, y, z;
+  std::uint8_t flags;
+};
+
+using Particles =
+    s21::SoAVector<std::int64_t, float, float, float, std::uint8_t>;
+
+TEST(SoAVector, T0ColumnsAreContiguous) {
+  std::vector<Particle> aos;
+  Particles soa;
+  for (int i = 0; i < 1000; ++i) {
+    const Particle particle{i, i * 0.5f, i * 2.0f, -1.0f,
+                            static_cast<std::uint8_t>(i % 4)};
+    aos.push_back(particle);
+    soa.Emplace_back(particle.id, particle.x, particle.y, particle.z,
+                     particle.flags);
+  }
+
+  // a kernel over one field reads only the array of that field
+  const float* x = soa.Data<1>();
+  const float soa_sum = std::accumulate(x, x + soa.Size(), 0.0f);
+  float aos_sum = 0.0f;
+  for (const auto& particle : aos) aos_sum += particle.x;
+
+  EXPECT_EQ(soa.Size(), aos.size());
+  EXPECT_FLOAT_EQ(soa_sum, aos_sum);
+  EXPECT_EQ(soa.Data<2>() + 999, &soa.Get<2>(999ull));
+  EXPECT_EQ(soa.Column<4>().Size(), 1000ull);
+}
+
+TEST(SoAVector, T0RowReferences) {
+  s21::SoAVector<int, std::string> soa{{1, "one"}, {2, "two"}};
+
+  auto [number, name] = soa[1];
+  number = 20;
+  name += "!";
+  std::get<0>(soa.Front()) = 10;
+
+  EXPECT_EQ(soa.Get<0>(0ull), 10);
+  EXPECT_EQ(soa.Get<0>(1ull), 20);
+  EXPECT_EQ(soa.Get<1>(1ull), "two!");
+  EXPECT_TRUE(soa.At(1ull) == std::make_tuple(20, std::string("two!")));
+  EXPECT_THROW(soa.At(2ull), std::out_of_range);
+}
+
+TEST(SoAVector, T0Iterators) {
+  s21::SoAVector<int, double> soa;
+  for (int i = 0; i < 10; ++i) soa.Push_back({i, i * 1.5});
+
+  int count = 0;
+  for (auto [number, fraction] : soa) {
+    fraction += number;
+    ++count;
+  }
+  EXPECT_EQ(count, 10);
+  EXPECT_DOUBLE_EQ(soa.Get<1>(4ull), 10.0);
+
+  const auto& constant = soa;
+  const auto found =
+      std::find_if(constant.begin(), constant.end(),
+                   [](const auto& row) { return std::get<0>(row) == 7; });
+  EXPECT_EQ(found - constant.cbegin(), 7);
+  EXPECT_EQ(std::get<0>(found[-2]), 5);
+  EXPECT_TRUE(found < soa.end());
+  EXPECT_EQ(soa.end() - soa.begin(), 10);
+}
+
+TEST(SoAVector, T0Capacity) {
+  s21::SoAVector<Item, int> soa(3ull);
+  EXPECT_EQ(soa.Size(), 3ull);
+  EXPECT_EQ(soa.Back(), std::make_tuple(Item(), 0));
+
+  soa.Reserve(50ull);
+  EXPECT_GE(soa.Capacity(), 50ull);
+  soa.Pop_back();
+  soa.Shrink_to_fit();
+  EXPECT_EQ(soa.Capacity(), 2ull);
+
+  s21::SoAVector<Item, int> other{{Item(5), 5}};
+  soa.Swap(other);
+  EXPECT_EQ(soa.Size(), 1ull);
+  EXPECT_TRUE(soa != other);
+
+  other.Clear();
+  EXPECT_TRUE(other.Empty());
+  other.Push_back(std::make_tuple(Item(5), 5));
+  EXPECT_TRUE(soa == other);
+}
+
+}  // namespace
+
+// GCOVR_EXCL_STOP
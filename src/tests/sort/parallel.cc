@@ -0,0 +1,155 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../../s21_parallel_sort.h"
+#include "../../s21_vector.h"
+
+// GCOVR_EXCL_START
+
+namespace {
+
+struct Record {
+  std::int32_t key;
+  int order;
+};
+
+// restores all the cores when the test is over
+struct ThreadsGuard {
+  ~ThreadsGuard() { s21::par::Set_threads(0ull); }
+};
+
+std::vector<std::uint64_t> make_random(std::size_t size, unsigned seed) {
+  std::mt19937_64 generator(seed);
+  std::vector<std::uint64_t> result(size);
+  for (auto& value : result) value = generator() % (size * 4ull);
+  return result;
+}
+
+TEST(ParallelSort, T0Threads) {
+  ThreadsGuard guard;
+  EXPECT_GE(s21::par::Threads(), 1ull);
+  s21::par::Set_threads(3ull);
+  EXPECT_EQ(s21::par::Threads(), 3ull);
+}
+
+TEST(ParallelSort, T1Sort) {
+  ThreadsGuard guard;
+  for (std::size_t threads : {1ull, 2ull, 3ull, 8ull})
+    for (std::size_t size : {0ull, 1ull, 1000ull, 70000ull, 200001ull}) {
+      s21::par::Set_threads(threads);
+      std::vector<std::uint64_t> expected = make_random(size, 7u);
+      s21::Vector<std::uint64_t> vector(expected.begin(), expected.end());
+
+      s21::par::Sort(vector);
+      std::sort(expected.begin(), expected.end());
+      ASSERT_TRUE(std::equal(vector.begin(), vector.end(), expected.begin(),
+                             expected.end()))
+          << threads << " threads, " << size << " elements";
+    }
+}
+
+TEST(ParallelSort, T2CompareAndProjection) {
+  ThreadsGuard guard;
+  s21::par::Set_threads(4ull);
+  std::vector<std::uint64_t> source = make_random(100000ull, 3u);
+  s21::Vector<Record> vector;
+  for (std::size_t i = 0ull; i < source.size(); ++i)
+    vector.Push_back({static_cast<std::int32_t>(source[i] % 1000ull),
+                      static_cast<int>(i)});
+
+  s21::par::Sort(vector, std::greater<>(), &Record::key);
+  EXPECT_TRUE(std::is_sorted(
+      vector.begin(), vector.end(),
+      [](const Record& l, const Record& r) { return l.key > r.key; }));
+
+  std::vector<int> orders;
+  for (const auto& record : vector) orders.push_back(record.order);
+  std::sort(orders.begin(), orders.end());
+  for (std::size_t i = 0ull; i < orders.size(); ++i)
+    ASSERT_EQ(orders[i], static_cast<int>(i));
+}
+
+TEST(ParallelSort, T3Merge) {
+  ThreadsGuard guard;
+  for (std::size_t threads : {1ull, 3ull, 8ull})
+    for (std::size_t size : {0ull, 10ull, 50000ull, 150000ull}) {
+      s21::par::Set_threads(threads);
+      std::vector<std::uint64_t> left = make_random(size, 11u);
+      std::vector<std::uint64_t> right = make_random(size / 3ull + 1ull, 12u);
+      std::sort(left.begin(), left.end());
+      std::sort(right.begin(), right.end());
+
+      s21::Vector<std::uint64_t> merged =
+          s21::par::Merge(s21::Vector<std::uint64_t>(left.begin(), left.end()),
+                          s21::Vector<std::uint64_t>(right.begin(),
+                                                     right.end()));
+      std::vector<std::uint64_t> expected;
+      std::merge(left.begin(), left.end(), right.begin(), right.end(),
+                 std::back_inserter(expected));
+      ASSERT_TRUE(std::equal(merged.begin(), merged.end(), expected.begin(),
+                             expected.end()))
+          << threads << " threads, " << size << " elements";
+    }
+}
+
+TEST(ParallelSort, T4MergeIsStable) {
+  ThreadsGuard guard;
+  s21::par::Set_threads(5ull);
+  std::vector<Record> left, right;
+  for (int i = 0; i < 90000; ++i) left.push_back({i / 7, i});
+  for (int i = 0; i < 60000; ++i) right.push_back({i / 3, -i - 1});
+  auto by_key = [](const Record& l, const Record& r) { return l.key < r.key; };
+
+  std::vector<Record> merged(left.size() + right.size());
+  s21::par::Merge(left.begin(), left.end(), right.begin(), right.end(),
+                  merged.begin(), by_key);
+  std::vector<Record> expected;
+  std::merge(left.begin(), left.end(), right.begin(), right.end(),
+             std::back_inserter(expected), by_key);
+  for (std::size_t i = 0ull; i < expected.size(); ++i) {
+    ASSERT_EQ(merged[i].key, expected[i].key) << i;
+    ASSERT_EQ(merged[i].order, expected[i].order) << i;
+  }
+}
+
+TEST(ParallelSort, T5Exception) {
+  ThreadsGuard guard;
+  s21::par::Set_threads(4ull);
+  std::vector<std::uint64_t> source = make_random(100000ull, 5u);
+  source[70000] = 12345ull;
+  s21::Vector<std::uint64_t> vector(source.begin(), source.end());
+  EXPECT_THROW(s21::par::Sort(vector,
+                              [](std::uint64_t l, std::uint64_t r) -> bool {
+                                if (l == 12345ull || r == 12345ull)
+                                  throw std::runtime_error("compare");
+                                return l < r;
+                              }),
+               std::runtime_error);
+}
+
+TEST(ParallelSort, T6SortStrings) {
+  ThreadsGuard guard;
+  s21::par::Set_threads(5ull);
+  std::vector<std::uint64_t> source = make_random(70000ull, 9u);
+  std::vector<std::string> expected;
+  for (std::uint64_t value : source)
+    expected.push_back("string long enough to be on the heap " +
+                       std::to_string(value));
+  s21::Vector<std::string> vector(expected.begin(), expected.end());
+
+  s21::par::Sort(vector);
+  std::sort(expected.begin(), expected.end());
+  ASSERT_TRUE(std::equal(vector.begin(), vector.end(), expected.begin(),
+                         expected.end()));
+}
+
+}  // namespace
+
+// GCOVR_EXCL_STOP
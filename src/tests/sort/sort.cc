@@ -0,0 +1,188 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../../s21_array.h"
+#include "../../s21_sort.h"
+#include "../../s21_vector.h"
+#include "../item.h"
+#include "../vector_helpers.h"
+
+// GCOVR_EXCL_START
+
+namespace {
+
+enum class Pattern { kUniform, kSorted, kReverse, kFewUnique, kOrganPipe };
+
+const Pattern kPatterns[] = {Pattern::kUniform, Pattern::kSorted,
+                             Pattern::kReverse, Pattern::kFewUnique,
+                             Pattern::kOrganPipe};
+
+template <typename Type>
+std::vector<Type> make_input(Pattern pattern, std::size_t size,
+                             unsigned seed = 42u) {
+  std::mt19937_64 generator(seed);
+  std::vector<Type> result(size);
+  for (std::size_t i = 0ull; i < size; ++i) {
+    switch (pattern) {
+      case Pattern::kUniform:
+        result[i] = static_cast<Type>(generator());
+        break;
+      case Pattern::kSorted:
+        result[i] = static_cast<Type>(i);
+        break;
+      case Pattern::kReverse:
+        result[i] = static_cast<Type>(size - i);
+        break;
+      case Pattern::kFewUnique:
+        result[i] = static_cast<Type>(generator() % 4ull);
+        break;
+      case Pattern::kOrganPipe:
+        result[i] = static_cast<Type>(i < size / 2ull ? i : size - i);
+        break;
+    }
+  }
+  return result;
+}
+
+struct Record {
+  std::int32_t key;
+  int order;
+};
+
+TEST(Sort, T0Patterns) {
+  for (Pattern pattern : kPatterns)
+    for (std::size_t size : {0ull, 1ull, 5ull, 30ull, 200ull, 100000ull}) {
+      auto vector = make_input<std::int32_t>(pattern, size);
+      s21::Vector<std::int32_t> s21_vector(vector.cbegin(), vector.cend());
+
+      s21::Sort(s21_vector);
+      std::sort(vector.begin(), vector.end());
+      EXPECT_TRUE(s21_vector == vector);
+    }
+}
+
+TEST(Sort, T0Iterators) {
+  std::vector<Item> vector;
+  for (int i : make_input<int>(Pattern::kUniform, 1000ull))
+    vector.emplace_back(i % 100);
+  s21::Vector<Item> s21_vector(vector.cbegin(), vector.cend());
+
+  s21::Sort(s21_vector.begin(), s21_vector.end(), ComparatorItem());
+  std::sort(vector.begin(), vector.end(), ComparatorItem());
+  EXPECT_EQ(s21_vector, vector);
+}
+
+TEST(Sort, T0CompareProjection) {
+  s21::Array<std::string, 5> s21_array{"pear", "fig", "banana", "kiwi",
+                                       "apple"};
+
+  s21::Sort(s21_array, std::greater<>(), &std::string::size);
+  EXPECT_EQ(s21_array[0], "banana");
+  EXPECT_EQ(s21_array[1], "apple");
+  EXPECT_EQ(s21_array[4], "fig");
+}
+
+TEST(Sort, T0StableSort) {
+  for (Pattern pattern : kPatterns) {
+    const auto keys = make_input<std::int32_t>(pattern, 5000ull);
+    std::vector<Record> vector;
+    for (std::size_t i = 0ull; i < keys.size(); ++i)
+      vector.push_back({keys[i] % 50, static_cast<int>(i)});
+    s21::Vector<Record> s21_vector(vector.cbegin(), vector.cend());
+
+    s21::Stable_sort(s21_vector, std::less<>(), &Record::key);
+    std::stable_sort(
+        vector.begin(), vector.end(),
+        [](const Record& l, const Record& r) { return l.key < r.key; });
+    for (std::size_t i = 0ull; i < vector.size(); ++i) {
+      ASSERT_EQ(s21_vector[i].key, vector[i].key);
+      ASSERT_EQ(s21_vector[i].order, vector[i].order);
+    }
+  }
+}
+
+TEST(Sort, T0StableSortItems) {
+  std::vector<Item> vector;
+  for (int i = 0; i < 300; ++i) vector.emplace_back(i % 7, 'a' + i % 26);
+  s21::Vector<Item> s21_vector(vector.cbegin(), vector.cend());
+
+  s21::Stable_sort(s21_vector.begin(), s21_vector.end(), ComparatorItem());
+  std::stable_sort(vector.begin(), vector.end(), ComparatorItem());
+  EXPECT_EQ(s21_vector, vector);
+}
+
+TEST(Sort, T0RadixSortIntegers) {
+  for (Pattern pattern : kPatterns) {
+    auto unsigned_vector = make_input<std::uint32_t>(pattern, 10000ull);
+    auto signed_vector = make_input<std::int64_t>(pattern, 10000ull);
+    for (auto& value : signed_vector) value -= 1000;
+    s21::Vector<std::uint32_t> s21_unsigned(unsigned_vector.cbegin(),
+                                            unsigned_vector.cend());
+    s21::Vector<std::int64_t> s21_signed(signed_vector.cbegin(),
+                                         signed_vector.cend());
+
+    s21::Radix_sort(s21_unsigned);
+    s21::Radix_sort(s21_signed.Data(), s21_signed.Data() + s21_signed.Size());
+    std::sort(unsigned_vector.begin(), unsigned_vector.end());
+    std::sort(signed_vector.begin(), signed_vector.end());
+    EXPECT_TRUE(s21_unsigned == unsigned_vector);
+    EXPECT_TRUE(s21_signed == signed_vector);
+  }
+}
+
+TEST(Sort, T0RadixSortFloating) {
+  std::mt19937 generator(7u);
+  std::uniform_real_distribution<double> distribution(-1e6, 1e6);
+  std::vector<double> doubles;
+  std::vector<float> floats;
+  for (int i = 0; i < 5000; ++i) {
+    doubles.push_back(distribution(generator));
+    floats.push_back(static_cast<float>(distribution(generator)));
+  }
+  s21::Vector<double> s21_doubles(doubles.cbegin(), doubles.cend());
+  s21::Vector<float> s21_floats(floats.cbegin(), floats.cend());
+
+  s21::Radix_sort(s21_doubles);
+  s21::Radix_sort(s21_floats);
+  std::sort(doubles.begin(), doubles.end());
+  std::sort(floats.begin(), floats.end());
+  EXPECT_TRUE(s21_doubles == doubles);
+  EXPECT_TRUE(s21_floats == floats);
+}
+
+TEST(Sort, T0RadixSortRecordsIsStable) {
+  const auto keys = make_input<std::int32_t>(Pattern::kUniform, 5000ull);
+  std::vector<Record> vector;
+  for (std::size_t i = 0ull; i < keys.size(); ++i)
+    vector.push_back({keys[i] % 1000, static_cast<int>(i)});
+  s21::Vector<Record> s21_vector(vector.cbegin(), vector.cend());
+
+  s21::Radix_sort(s21_vector, &Record::key);
+  std::stable_sort(
+      vector.begin(), vector.end(),
+      [](const Record& l, const Record& r) { return l.key < r.key; });
+  for (std::size_t i = 0ull; i < vector.size(); ++i) {
+    ASSERT_EQ(s21_vector[i].key, vector[i].key);
+    ASSERT_EQ(s21_vector[i].order, vector[i].order);
+  }
+}
+
+TEST(Sort, T0RadixSortStrings) {
+  s21::Vector<std::string> s21_vector{"ccc", "a", "bb", "", "dddd"};
+
+  s21::Radix_sort(s21_vector, [](const std::string& s) {
+    return static_cast<std::uint8_t>(5u - s.size());
+  });
+  EXPECT_TRUE(s21_vector ==
+              std::vector<std::string>({"dddd", "ccc", "bb", "a", ""}));
+}
+
+}  // namespace
+
+// GCOVR_EXCL_STOP
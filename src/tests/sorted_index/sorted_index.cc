@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../../s21_sorted_index.h"
+#include "../../s21_vector.h"
+
+// GCOVR_EXCL_START
+
+namespace {
+
+// every key of [0, 2 * size + 1] is looked for in 0, 2, 4 ...
+TEST(SortedIndex, T0EverySize) {
+  for (std::uint32_t size = 0u; size < 300u; ++size) {
+    s21::Vector<std::uint32_t> sorted;
+    for (std::uint32_t i = 0u; i < size; ++i) sorted.Push_back(2u * i);
+    s21::SortedIndex<std::uint32_t> index(sorted);
+    ASSERT_EQ(index.Size(), size);
+
+    for (std::uint32_t key = 0u; key <= 2u * size + 1u; ++key) {
+      const std::size_t expected = static_cast<std::size_t>(
+          std::lower_bound(sorted.Data(), sorted.Data() + size, key) -
+          sorted.Data());
+      ASSERT_EQ(index.Lower_bound(key), expected) << size << " " << key;
+      ASSERT_EQ(index.Contains(key), key % 2u == 0u && key < 2u * size);
+      ASSERT_EQ(index.Find(key), index.Contains(key)
+                                     ? expected
+                                     : s21::SortedIndex<std::uint32_t>::npos);
+    }
+  }
+}
+
+TEST(SortedIndex, T1Empty) {
+  s21::SortedIndex<int> index;
+  EXPECT_TRUE(index.Empty());
+  EXPECT_EQ(index.Lower_bound(5), 0ull);
+  EXPECT_FALSE(index.Contains(5));
+}
+
+TEST(SortedIndex, T2Duplicates) {
+  std::mt19937_64 generator(42u);
+  std::vector<std::uint64_t> sorted(100000ull);
+  for (auto& key : sorted) key = generator() % 20000ull;
+  std::sort(sorted.begin(), sorted.end());
+  s21::SortedIndex<std::uint64_t> index(sorted.data(), sorted.size());
+
+  for (std::uint64_t key = 0ull; key <= 20000ull; ++key) {
+    const auto expected = static_cast<std::size_t>(
+        std::lower_bound(sorted.begin(), sorted.end(), key) - sorted.begin());
+    ASSERT_EQ(index.Lower_bound(key), expected) << key;
+  }
+}
+
+TEST(SortedIndex, T3Batch) {
+  std::mt19937 generator(7u);
+  s21::Vector<std::int32_t> sorted;
+  for (int i = 0; i < 5000; ++i)
+    sorted.Push_back(static_cast<std::int32_t>(generator() % 100000u) - 50000);
+  std::sort(sorted.Data(), sorted.Data() + sorted.Size());
+  s21::SortedIndex<std::int32_t> index(sorted);
+
+  s21::Vector<std::int32_t> keys;
+  for (int i = 0; i < 1001; ++i)
+    keys.Push_back(static_cast<std::int32_t>(generator() % 120000u) - 60000);
+  s21::Vector<std::size_t> ranks = index.Lower_bound(keys);
+  ASSERT_EQ(ranks.Size(), keys.Size());
+  for (std::size_t i = 0ull; i < keys.Size(); ++i)
+    ASSERT_EQ(ranks[i], index.Lower_bound(keys[i])) << i;
+}
+
+TEST(SortedIndex, T4Comparator) {
+  s21::Vector<std::string> sorted{"pear", "orange", "kiwi", "apple"};
+  s21::SortedIndex<std::string, std::greater<std::string>> index(sorted);
+  EXPECT_EQ(index.Lower_bound("zebra"), 0ull);
+  EXPECT_EQ(index.Lower_bound("orange"), 1ull);
+  EXPECT_EQ(index.Lower_bound("lemon"), 2ull);
+  EXPECT_EQ(index.Lower_bound("a"), 4ull);
+  EXPECT_TRUE(index.Contains("kiwi"));
+  EXPECT_FALSE(index.Contains("lemon"));
+  EXPECT_EQ(index.Find("apple"), 3ull);
+}
+
+TEST(SortedIndex, T5Assign) {
+  s21::Vector<int> sorted{1, 3, 5};
+  s21::SortedIndex<int> index(sorted);
+  EXPECT_EQ(index.Lower_bound(4), 2ull);
+  const int other[] = {10, 20};
+  index.Assign(other, 2ull);
+  EXPECT_EQ(index.Size(), 2ull);
+  EXPECT_EQ(index.Lower_bound(4), 0ull);
+  EXPECT_EQ(index.Lower_bound(15), 1ull);
+  EXPECT_FALSE(index.Contains(5));
+}
+
+}  // namespace
+
+// GCOVR_EXCL_STOP
@@ -0,0 +1,156 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "../../s21_array.h"
+#include "../../s21_small_vector.h"
+#include "../../s21_span.h"
+#include "../../s21_vector.h"
+#include "../item.h"
+
+// GCOVR_EXCL_START
+
+namespace {
+
+int sum(s21::Span<const int> span) {
+  int result = 0;
+  for (int value : span) result += value;
+  return result;
+}
+
+TEST(Span, T0Constructors) {
+  s21::Span<int> empty;
+  EXPECT_TRUE(empty.Empty());
+  EXPECT_EQ(empty.Data(), nullptr);
+
+  s21::Vector<int> vector{1, 2, 3, 4};
+  s21::Span<int> of_vector(vector);
+  EXPECT_EQ(of_vector.Data(), vector.Data());
+  EXPECT_EQ(of_vector.Size(), 4ull);
+  of_vector[0] = 10;
+  EXPECT_EQ(vector[0], 10);
+
+  const s21::Array<int, 3> array{5, 6, 7};
+  s21::Span<const int> of_array(array);
+  EXPECT_EQ(of_array.Back(), 7);
+
+  int raw[] = {1, 1, 1, 1, 1};
+  s21::Span of_raw(raw);
+  static_assert(std::is_same_v<decltype(of_raw), s21::Span<int, 5ull>>);
+  static_assert(sizeof(of_raw) == sizeof(int*));
+  EXPECT_EQ(of_raw.Size(), 5ull);
+
+  s21::Span<int> of_pointers(raw + 1, raw + 3);
+  EXPECT_EQ(of_pointers.Size(), 2ull);
+  s21::Span of_count(raw, 4ull);
+  EXPECT_EQ(of_count.Size(), 4ull);
+
+  s21::SmallVector<int, 4> small{2, 2};
+  EXPECT_EQ(sum(small), 4);
+  EXPECT_EQ(sum(vector), 19);
+  EXPECT_EQ(sum(array), 18);
+  EXPECT_EQ(sum(of_raw), 5);
+  // a fixed extent converts to the dynamic one, Span<int> to Span<const int>
+  s21::Span<const int> converted = of_raw;
+  EXPECT_EQ(converted.Size(), 5ull);
+
+  static_assert(
+      !std::is_constructible_v<s21::Span<int>, const s21::Vector<int>&>);
+  static_assert(!std::is_constructible_v<s21::Span<int, 3>, int (&)[4]>);
+}
+
+TEST(Span, T1Access) {
+  s21::Vector<std::string> words{"a", "b", "c"};
+  s21::Span<std::string> span(words);
+  EXPECT_EQ(span.Front(), "a");
+  EXPECT_EQ(span.At(2), "c");
+  EXPECT_THROW(span.At(3), std::out_of_range);
+  EXPECT_EQ(span.Size_bytes(), 3ull * sizeof(std::string));
+
+  std::string joined;
+  for (auto it = span.rbegin(); it != span.rend(); ++it) joined += *it;
+  EXPECT_EQ(joined, "cba");
+  EXPECT_EQ(span.end() - span.begin(), 3);
+}
+
+TEST(Span, T2Subspans) {
+  int raw[] = {0, 1, 2, 3, 4, 5, 6, 7};
+  s21::Span<int, 8> span(raw);
+
+  auto first = span.First<3>();
+  static_assert(std::is_same_v<decltype(first), s21::Span<int, 3ull>>);
+  EXPECT_EQ(first.Back(), 2);
+  auto last = span.Last<2>();
+  EXPECT_EQ(last.Front(), 6);
+  auto middle = span.Subspan<2, 4>();
+  static_assert(decltype(middle)::kExtent == 4ull);
+  EXPECT_EQ(middle.Front(), 2);
+  EXPECT_EQ(middle.Back(), 5);
+  auto rest = span.Subspan<5>();
+  static_assert(decltype(rest)::kExtent == 3ull);
+  EXPECT_EQ(rest.Front(), 5);
+
+  s21::Span<int> dynamic = span;
+  EXPECT_EQ(dynamic.First(2).Back(), 1);
+  EXPECT_EQ(dynamic.Last(3).Front(), 5);
+  EXPECT_EQ(dynamic.Subspan(1, 2).Back(), 2);
+  EXPECT_EQ(dynamic.Subspan(6).Size(), 2ull);
+  auto dynamic_rest = dynamic.Subspan<6>();
+  static_assert(decltype(dynamic_rest)::kExtent == s21::kDynamicExtent);
+  EXPECT_EQ(dynamic_rest.Size(), 2ull);
+  EXPECT_TRUE(dynamic.Subspan(8).Empty());
+}
+
+TEST(Span, T3Compare) {
+  s21::Vector<int> vector{1, 2, 3};
+  s21::Array<int, 3> array{1, 2, 3};
+  EXPECT_EQ(s21::Span<const int>(vector), s21::Span<int>(array));
+  EXPECT_NE(s21::Span<int>(vector).First(2), s21::Span<int>(array));
+}
+
+TEST(Span, T4VectorFromSpan) {
+  std::vector<std::uint8_t> buffer{'h', 'e', 'a', 'd', 'e', 'r', 'b', 'o'};
+  s21::Span<const std::uint8_t> span(buffer.data(), buffer.size());
+  s21::Vector<std::uint8_t> header(span.First(6));
+  EXPECT_EQ(header, (s21::Vector<std::uint8_t>{'h', 'e', 'a', 'd', 'e',
+                                                 'r'}));
+
+  s21::Array<Item, 2> items{Item(1), Item(2)};
+  s21::Vector<Item> copied(items);
+  EXPECT_EQ(copied.Size(), 2ull);
+  EXPECT_EQ(copied[1].number(), 2);
+
+  s21::Vector<int, s21::Growth::Exact> exact{1, 2};
+  s21::Vector<int> other_growth(s21::Span<const int>{exact});
+  EXPECT_EQ(other_growth, (s21::Vector<int>{1, 2}));
+}
+
+TEST(Span, T5Append) {
+  s21::Vector<int> vector{1, 2};
+  const int more[] = {3, 4, 5};
+  vector.Append(more);
+  EXPECT_EQ(vector, (s21::Vector<int>{1, 2, 3, 4, 5}));
+  vector.Append(s21::Span<const int>());
+  EXPECT_EQ(vector.Size(), 5ull);
+
+  // a part of itself, while it reallocates
+  vector.Shrink_to_fit();
+  vector.Append(s21::Span<int>(vector).Subspan(1, 3));
+  EXPECT_EQ(vector, (s21::Vector<int>{1, 2, 3, 4, 5, 2, 3, 4}));
+
+  s21::Vector<std::string> words{"a"};
+  s21::Vector<std::string> tail{"b", "c"};
+  words.Append(tail);
+  words.Shrink_to_fit();
+  words.Append(words);
+  EXPECT_EQ(words,
+            (s21::Vector<std::string>{"a", "b", "c", "a", "b", "c"}));
+}
+
+}  // namespace
+
+// GCOVR_EXCL_STOP
@@ -6,6 +6,7 @@
 #include <vector>
 
 #include "../../s21_stack.h"
+#include "../allocator.h"
 #include "../item.h"
 #include "../stack_helpers.h"
 
@@ -104,5 +105,24 @@ TEST(Stack, T8ConstructorIterator) {
   EXPECT_EQ(s21_stack, stack);
 }
 
+TEST(Stack, T9ConstructorAllocator) {
+  using CountingList = s21::List<Item, CountingAllocator<Item>>;
+  AllocationStatistics statistics;
+  const CountingAllocator<Item> allocator(&statistics);
+  {
+    const CountingList source{Item(11), Item(22), Item(33)};
+    s21::Stack<Item, CountingList> s21_stack(source, allocator);
+    s21::Stack<Item, CountingList> s21_moved(std::move(s21_stack), allocator);
+    s21::Stack<Item, CountingList> s21_empty(allocator);
+    s21_empty.Push(Item(44));
+
+    std::list<Item> list{Item(11), Item(22), Item(33)};
+    std::stack<Item, std::list<Item>> stack(list);
+    EXPECT_EQ(statistics.allocations, 4ull);
+    EXPECT_TRUE(s21_moved == stack);
+  }
+  EXPECT_EQ(statistics.allocated, 0ull);
+}
+
 }  // namespace
    // GCOVR_EXCL_STOP
@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "../../s21_aligned_allocator.h"
+#include "../../s21_array.h"
+#include "../../s21_vector.h"
+#include "../item.h"
+#include "../vector_helpers.h"
+
+// GCOVR_EXCL_START
+
+namespace {
+
+bool aligned(const void* pointer, std::size_t alignment) {
+  return reinterpret_cast<std::uintptr_t>(pointer) % alignment == 0ull;
+}
+
+TEST(Vector, T0AlignedAllocatorGrowth) {
+  s21::AlignedVector<float> s21_vector;
+  std::vector<float> vector;
+  for (int i = 0; i < 1000; ++i) {
+    s21_vector.Push_back(i * 0.5f);
+    vector.push_back(i * 0.5f);
+    ASSERT_TRUE(aligned(s21_vector.Data(), 64ull));
+  }
+
+  EXPECT_TRUE(s21_vector == vector);
+}
+
+TEST(Vector, T0AlignedAllocatorPaddedTail) {
+  // 5 floats take 20 bytes, the chunk is padded up to the whole 64-byte
+  // block: a register loaded at Data() may take all 16 lanes
+  s21::AlignedVector<float, 64, s21::Growth::Exact> s21_vector(5ull, 1.0f);
+  float lanes[16];
+  std::memcpy(lanes, s21_vector.Data(), sizeof(lanes));
+
+  EXPECT_EQ(s21_vector.Capacity(), 5ull);
+  float sum = 0.0f;
+  for (std::size_t i = 0ull; i < s21_vector.Size(); ++i) sum += lanes[i];
+  EXPECT_FLOAT_EQ(sum, 5.0f);
+}
+
+TEST(Vector, T0AlignedAllocatorItems) {
+  s21::AlignedVector<Item, 128> s21_vector{Item(1), Item(2), Item(3)};
+  s21_vector.Insert(s21_vector.cbegin() + 1, 10ull, Item(7));
+  s21_vector.Shrink_to_fit();
+
+  EXPECT_TRUE(aligned(s21_vector.Data(), 128ull));
+  EXPECT_EQ(s21_vector.Size(), 13ull);
+  EXPECT_EQ(s21_vector[5], Item(7));
+  EXPECT_TRUE((s21_vector.Get_allocator() ==
+               s21::AlignedAllocator<Item, 128>()));
+}
+
+TEST(Array, T0Aligned) {
+  s21::Array<float, 5, 64> s21_array{1.0f, 2.0f, 3.0f, 4.0f, 5.0f};
+  const s21::Array<float, 5, 64> s21_copy(s21_array);
+  const s21::Array<float, 5> s21_plain{1.0f, 2.0f, 3.0f, 4.0f, 5.0f};
+
+  EXPECT_TRUE(aligned(s21_array.Data(), 64ull));
+  EXPECT_EQ(alignof(decltype(s21_array)), 64ull);
+  EXPECT_EQ(sizeof(s21_array), 64ull);  // padded up to the whole block
+  EXPECT_TRUE(s21_copy == s21_plain);
+}
+
+}  // namespace
+
+// GCOVR_EXCL_STOP
@@ -0,0 +1,147 @@
+#include <gtest/gtest.h>
+
+#include <memory_resource>
+#include <vector>
+
+#include "../../s21_vector.h"
+#include "../allocator.h"
+#include "../item.h"
+#include "../vector_helpers.h"
+
+// GCOVR_EXCL_START
+
+namespace {
+
+template <bool Propagate = false>
+using CountingVector = s21::Vector<Item, s21::Growth::PowerOfTwo,
+                                   CountingAllocator<Item, Propagate>>;
+
+TEST(Vector, T0AllocatorCounts) {
+  AllocationStatistics statistics;
+  {
+    CountingVector<> s21_vector{CountingAllocator<Item>(&statistics)};
+    std::vector<Item> vector;
+    for (int i = 0; i < 100; ++i) {
+      s21_vector.Push_back(Item(i));
+      vector.push_back(Item(i));
+    }
+
+    EXPECT_EQ(s21_vector, vector);
+    EXPECT_EQ(statistics.allocations, 7ull);  // 1, 3, 7 ... 127
+    EXPECT_EQ(statistics.allocated, 127ull);
+    EXPECT_TRUE(s21_vector.Get_allocator() ==
+                CountingAllocator<Item>(&statistics));
+  }
+  EXPECT_EQ(statistics.deallocations, statistics.allocations);
+  EXPECT_EQ(statistics.allocated, 0ull);
+}
+
+TEST(Vector, T0AllocatorCopyConstructor) {
+  AllocationStatistics statistics;
+  AllocationStatistics other_statistics;
+  const CountingVector<> s21_vector({Item(1), Item(2), Item(3)},
+                                    CountingAllocator<Item>(&statistics));
+
+  const CountingVector<> s21_copy(s21_vector);
+  EXPECT_EQ(statistics.allocations, 2ull);
+
+  const CountingVector<> s21_other(s21_vector,
+                                   CountingAllocator<Item>(&other_statistics));
+  EXPECT_EQ(statistics.allocations, 2ull);
+  EXPECT_EQ(other_statistics.allocations, 1ull);
+  EXPECT_EQ(s21_other, std::vector<Item>({Item(1), Item(2), Item(3)}));
+}
+
+// a steady-state copy loop allocates only when the source outgrows the
+// capacity
+TEST(Vector, T0AllocatorCopyAssignmentReuse) {
+  AllocationStatistics statistics;
+  const CountingVector<> big({Item(1), Item(2), Item(3), Item(4), Item(5)},
+                             CountingAllocator<Item>(&statistics));
+  const CountingVector<> small({Item(7), Item(8)},
+                               CountingAllocator<Item>(&statistics));
+  CountingVector<> s21_vector{CountingAllocator<Item>(&statistics)};
+  EXPECT_EQ(statistics.allocations, 2ull);
+
+  s21_vector = big;
+  EXPECT_EQ(statistics.allocations, 3ull);
+  for (int frame = 0; frame < 10; ++frame) {
+    s21_vector = frame % 2 ? big : small;
+    EXPECT_EQ(s21_vector, frame % 2 ? big : small);
+  }
+  EXPECT_EQ(statistics.allocations, 3ull);
+  EXPECT_EQ(s21_vector, std::vector<Item>({Item(1), Item(2), Item(3), Item(4),
+                                           Item(5)}));
+
+  s21_vector = small;
+  CountingVector<> bigger(10ull, Item(9), CountingAllocator<Item>(&statistics));
+  s21_vector = bigger;
+  EXPECT_EQ(statistics.allocations, 5ull);
+  EXPECT_EQ(s21_vector, std::vector<Item>(10ull, Item(9)));
+}
+
+TEST(Vector, T0AllocatorMoveUnequal) {
+  AllocationStatistics statistics;
+  AllocationStatistics other_statistics;
+  CountingVector<> s21_vector({Item(1), Item(2), Item(3)},
+                              CountingAllocator<Item>(&statistics));
+
+  CountingVector<> s21_other{CountingAllocator<Item>(&other_statistics)};
+  s21_other = std::move(s21_vector);
+
+  // the elements are moved into the memory of the own allocator
+  EXPECT_EQ(other_statistics.allocations, 1ull);
+  EXPECT_TRUE(s21_other.Get_allocator() ==
+              CountingAllocator<Item>(&other_statistics));
+  EXPECT_EQ(s21_other, std::vector<Item>({Item(1), Item(2), Item(3)}));
+}
+
+TEST(Vector, T0AllocatorMovePropagate) {
+  AllocationStatistics statistics;
+  AllocationStatistics other_statistics;
+  CountingVector<true> s21_vector(
+      {Item(1), Item(2), Item(3)},
+      CountingAllocator<Item, true>(&statistics));
+
+  CountingVector<true> s21_other{
+      CountingAllocator<Item, true>(&other_statistics)};
+  s21_other = std::move(s21_vector);
+
+  // the memory is taken together with the allocator
+  EXPECT_EQ(statistics.allocations, 1ull);
+  EXPECT_EQ(other_statistics.allocations, 0ull);
+  EXPECT_TRUE((s21_other.Get_allocator() ==
+               CountingAllocator<Item, true>(&statistics)));
+  EXPECT_EQ(s21_other, std::vector<Item>({Item(1), Item(2), Item(3)}));
+}
+
+TEST(Vector, T0AllocatorSwapPropagate) {
+  AllocationStatistics statistics;
+  AllocationStatistics other_statistics;
+  CountingVector<true> s21_vector(
+      {Item(1), Item(2)}, CountingAllocator<Item, true>(&statistics));
+  CountingVector<true> s21_other(
+      {Item(3)}, CountingAllocator<Item, true>(&other_statistics));
+
+  s21_vector.Swap(s21_other);
+
+  EXPECT_TRUE((s21_vector.Get_allocator() ==
+               CountingAllocator<Item, true>(&other_statistics)));
+  EXPECT_EQ(s21_vector, std::vector<Item>({Item(3)}));
+  EXPECT_EQ(s21_other, std::vector<Item>({Item(1), Item(2)}));
+}
+
+TEST(Vector, T0PolymorphicAllocator) {
+  char buffer[1024];
+  std::pmr::monotonic_buffer_resource resource(buffer, sizeof(buffer),
+                                               std::pmr::null_memory_resource());
+  s21::pmr::Vector<int> s21_vector(&resource);
+  for (int i = 0; i < 10; ++i) s21_vector.Push_back(i);
+
+  EXPECT_EQ(s21_vector.Get_allocator().resource(), &resource);
+  EXPECT_TRUE(s21_vector == std::vector<int>({0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+}
+
+}  // namespace
+
+// GCOVR_EXCL_STOP
@@ -0,0 +1,181 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "../../s21_vector.h"
+#include "../allocator.h"
+#include "../vector_helpers.h"
+
+// GCOVR_EXCL_START
+
+namespace {
+
+TEST(VectorBool, T0PackedStorage) {
+  AllocationStatistics statistics;
+  s21::Vector<bool, s21::Growth::Exact, CountingAllocator<bool>> s21_vector(
+      1000ull, true, CountingAllocator<bool>(&statistics));
+
+  // 16 words of 64 bits instead of 1000 bytes
+  EXPECT_EQ(s21_vector.Bits().Word_count(), 16ull);
+  EXPECT_EQ(statistics.allocated, 16ull);
+  EXPECT_EQ(s21_vector.Bits().Count(), 1000ull);
+  EXPECT_TRUE(s21_vector == std::vector<bool>(1000ull, true));
+}
+
+TEST(VectorBool, T0PushBackAccess) {
+  s21::Vector<bool> s21_vector;
+  std::vector<bool> vector;
+  for (int i = 0; i < 200; ++i) {
+    s21_vector.Push_back(i % 3 == 0);
+    vector.push_back(i % 3 == 0);
+  }
+
+  EXPECT_TRUE(s21_vector == vector);
+  EXPECT_TRUE(s21_vector.Front());
+  EXPECT_FALSE(s21_vector.Back());
+  EXPECT_TRUE(s21_vector.At(198ull));
+  EXPECT_THROW(s21_vector.At(200ull), std::out_of_range);
+
+  s21_vector.Pop_back();
+  vector.pop_back();
+  EXPECT_TRUE(s21_vector == vector);
+}
+
+TEST(VectorBool, T0ProxyReference) {
+  s21::Vector<bool> s21_vector(70ull, false);
+  s21_vector[65] = true;
+  s21_vector[3] = s21_vector[65];
+  s21_vector[64].Flip();
+
+  EXPECT_TRUE(s21_vector[3]);
+  EXPECT_TRUE(s21_vector[64]);
+  EXPECT_FALSE(~s21_vector[64]);
+  EXPECT_EQ(s21_vector.Bits().Count(), 3ull);
+}
+
+TEST(VectorBool, T0Iterators) {
+  const std::vector<bool> vector{true,  false, false, true, true,
+                                 false, true,  false, true};
+  s21::Vector<bool> s21_vector(vector.cbegin(), vector.cend());
+
+  EXPECT_TRUE(s21_vector == vector);
+  EXPECT_TRUE(std::equal(s21_vector.crbegin(), s21_vector.crend(),
+                         vector.crbegin(), vector.crend()));
+  EXPECT_EQ(std::count(s21_vector.cbegin(), s21_vector.cend(), true), 5);
+
+  std::sort(s21_vector.begin(), s21_vector.end());
+  EXPECT_TRUE(std::is_sorted(s21_vector.cbegin(), s21_vector.cend()));
+  EXPECT_EQ(s21_vector.end() - s21_vector.begin(), 9);
+  EXPECT_FALSE(s21_vector.cbegin()[3]);
+  EXPECT_TRUE(s21_vector.cbegin()[4]);
+}
+
+TEST(VectorBool, T0IteratorsAcrossWords) {
+  s21::Vector<bool> s21_vector(300ull, false);
+  auto it = s21_vector.begin() + 200;
+  *it = true;
+  it -= 137;
+  *it = true;
+  --it;
+  ++it;
+
+  EXPECT_EQ(it - s21_vector.begin(), 63);
+  EXPECT_TRUE(s21_vector[63]);
+  EXPECT_TRUE(s21_vector[200]);
+  EXPECT_TRUE(s21_vector.begin() < it);
+  EXPECT_EQ(s21_vector.Bits().Find_first(), 63ull);
+}
+
+TEST(VectorBool, T0InsertErase) {
+  s21::Vector<bool> s21_vector{true, false, true};
+  std::vector<bool> vector{true, false, true};
+
+  for (int i = 0; i < 100; ++i) {
+    s21_vector.Insert(s21_vector.cbegin() + 1, i % 2 == 0);
+    vector.insert(vector.cbegin() + 1, i % 2 == 0);
+  }
+  s21_vector.Insert(s21_vector.cend(), 5ull, true);
+  vector.insert(vector.cend(), 5ull, true);
+  EXPECT_TRUE(s21_vector == vector);
+
+  s21_vector.Erase(s21_vector.cbegin() + 10, s21_vector.cbegin() + 80);
+  vector.erase(vector.cbegin() + 10, vector.cbegin() + 80);
+  s21_vector.Erase(s21_vector.cbegin());
+  vector.erase(vector.cbegin());
+  EXPECT_TRUE(s21_vector == vector);
+}
+
+TEST(VectorBool, T0InsertRangeEmplace) {
+  s21::Vector<bool> s21_vector{true, false, true};
+  std::vector<bool> vector{true, false, true};
+  const std::vector<bool> values(150ull, true);
+
+  s21_vector.Insert(s21_vector.cbegin() + 1, values.begin(), values.end());
+  vector.insert(vector.cbegin() + 1, values.begin(), values.end());
+  s21_vector.Insert(s21_vector.cbegin(), {false, false, true});
+  vector.insert(vector.cbegin(), {false, false, true});
+  auto it = s21_vector.Emplace(s21_vector.cbegin() + 2, 1);
+  vector.emplace(vector.cbegin() + 2, 1);
+  s21_vector.Emplace_back();
+  vector.emplace_back();
+  EXPECT_TRUE(*it);
+  EXPECT_TRUE(s21_vector == vector);
+
+  // a part of the vector itself
+  s21_vector.Insert(s21_vector.cbegin() + 100, s21_vector.cbegin(),
+                    s21_vector.cbegin() + 5);
+  const std::vector<bool> head(vector.begin(), vector.begin() + 5);
+  vector.insert(vector.cbegin() + 100, head.begin(), head.end());
+  EXPECT_TRUE(s21_vector == vector);
+}
+
+TEST(VectorBool, T0InsertMany) {
+  s21::Vector<bool> s21_vector{true, true};
+
+  auto it = s21_vector.Insert_many(s21_vector.cbegin() + 1, false, 0, true);
+  EXPECT_EQ(it - s21_vector.begin(), 4);
+  s21_vector.Insert_many_back(false, 1);
+  s21_vector.Insert_many_back();
+  EXPECT_TRUE(s21_vector == std::vector<bool>(
+                                {true, false, false, true, true, false, true}));
+}
+
+TEST(VectorBool, T0ResizeFlip) {
+  s21::Vector<bool> s21_vector{true, false};
+  std::vector<bool> vector{true, false};
+  s21_vector.Resize(100ull, true);
+  vector.resize(100ull, true);
+  EXPECT_TRUE(s21_vector == vector);
+
+  s21_vector.Flip();
+  vector.flip();
+  EXPECT_TRUE(s21_vector == vector);
+  EXPECT_EQ(s21_vector.Bits().Count(), 1ull);
+
+  s21_vector.Resize(10ull);
+  vector.resize(10ull);
+  s21_vector.Resize(70ull, true);
+  vector.resize(70ull, true);
+  EXPECT_TRUE(s21_vector == vector);
+}
+
+TEST(VectorBool, T0AssignSwap) {
+  s21::Vector<bool> s21_vector;
+  s21_vector.Assign(5ull, true);
+  s21::Vector<bool> s21_other{false, true};
+
+  s21_vector.Swap(s21_other);
+  EXPECT_TRUE(s21_vector == std::vector<bool>({false, true}));
+  EXPECT_TRUE(s21_other == std::vector<bool>(5ull, true));
+
+  s21_other.Assign({true, false, false});
+  EXPECT_TRUE(s21_other == std::vector<bool>({true, false, false}));
+  s21_other.Clear();
+  EXPECT_TRUE(s21_other.Empty());
+  EXPECT_TRUE(s21_vector != s21_other);
+}
+
+}  // namespace
+
+// GCOVR_EXCL_STOP
@@ -18,7 +18,7 @@ TEST(Vector, T0Capacity) {
   vector.reserve(100);
 
   EXPECT_EQ(s21_vector, vector);
-  EXPECT_EQ(s21_vector.Capacity(), 127ull);  // 2^n - 1
+  EXPECT_EQ(s21_vector.Capacity(), 100ull);  // exactly as requested
 }
 
 TEST(Vector, T1Capacity) {
@@ -43,7 +43,7 @@ TEST(Vector, T3Reserve) {
   vector.reserve(10);
 
   EXPECT_EQ(s21_vector, vector);
-  EXPECT_EQ(s21_vector.Capacity(), 15ull);  // 2^n - 1
+  EXPECT_EQ(s21_vector.Capacity(), 10ull);  // exactly as requested
 }
 
 TEST(Vector, T4Reserve) {
@@ -121,6 +121,71 @@ TEST(Vector, T8Shrink_to_fit) {
   EXPECT_EQ(s21_vector.Capacity(), vector.capacity());
 }
 
+TEST(Vector, T0GrowthPowerOfTwo) {
+  s21::Vector<int> s21_vector;
+  for (int i = 0; i < 1000; ++i) s21_vector.Push_back(i);
+  EXPECT_EQ(s21_vector.Capacity(), 1023ull);  // 2^n - 1
+  EXPECT_EQ(s21_vector.Capacity_waste(), 23ull * sizeof(int));
+}
+
+TEST(Vector, T0GrowthGeometric) {
+  s21::Vector<int, s21::Growth::Geometric> s21_vector;
+  std::size_t capacity = 0ull;
+  for (int i = 0; i < 1000; ++i) {
+    s21_vector.Push_back(i);
+    if (s21_vector.Capacity() != capacity) {
+      if (capacity > 1ull) {
+        EXPECT_EQ(s21_vector.Capacity(), capacity * 3 / 2);
+      }
+      capacity = s21_vector.Capacity();
+    }
+    EXPECT_LE(s21_vector.Capacity_waste(), s21_vector.Size() / 2 * sizeof(int));
+  }
+  EXPECT_EQ(s21_vector[999], 999);
+}
+
+TEST(Vector, T0GrowthExact) {
+  s21::Vector<int, s21::Growth::Exact> s21_vector{1, 2, 3};
+  EXPECT_EQ(s21_vector.Capacity(), 3ull);
+  for (int i = 0; i < 100; ++i) {
+    s21_vector.Push_back(i);
+    EXPECT_EQ(s21_vector.Capacity(), s21_vector.Size());
+    EXPECT_EQ(s21_vector.Capacity_waste(), 0ull);
+  }
+  s21_vector.Insert(s21_vector.cbegin(), 3ull, -1);
+  EXPECT_EQ(s21_vector.Capacity(), 106ull);
+}
+
+TEST(Vector, T0GrowthPage) {
+  s21::Vector<int, s21::Growth::Page<>> s21_vector;
+  s21_vector.Push_back(1);
+  EXPECT_EQ(s21_vector.Capacity(), 4096ull / sizeof(int));
+
+  for (int i = 0; i < 5000; ++i) s21_vector.Push_back(i);
+  EXPECT_EQ(s21_vector.Capacity() * sizeof(int) % 4096ull, 0ull);
+  EXPECT_GE(s21_vector.Capacity(), s21_vector.Size());
+  EXPECT_EQ(s21_vector[5000], 4999);
+}
+
+TEST(Vector, T0GrowthPolicyCompare) {
+  s21::Vector<Item, s21::Growth::Exact> s21_vector{Item(1), Item(2)};
+  s21::Vector<Item, s21::Growth::Exact> s21_vector_copy = s21_vector;
+  std::vector<Item> vector{Item(1), Item(2)};
+  EXPECT_EQ(s21_vector, vector);
+  EXPECT_TRUE(s21_vector == s21_vector_copy);
+}
+
+TEST(Vector, T0CapacityWaste) {
+  s21::Vector<double> s21_vector;
+  EXPECT_EQ(s21_vector.Capacity_waste(), 0ull);
+  s21_vector.Reserve(10);
+  EXPECT_EQ(s21_vector.Capacity_waste(), 10ull * sizeof(double));
+  s21_vector.Push_back(1.0);
+  EXPECT_EQ(s21_vector.Capacity_waste(), 9ull * sizeof(double));
+  s21_vector.Shrink_to_fit();
+  EXPECT_EQ(s21_vector.Capacity_waste(), 0ull);
+}
+
 }  // namespace
 
 // GCOVR_EXCL_STOP
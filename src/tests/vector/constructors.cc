@@ -371,6 +371,20 @@ TEST(Vector, T31AssignCountValueZero) {
   EXPECT_EQ(s21_vector, vector);
 }
 
+TEST(Vector, T32ConstructorGenerator) {
+  const s21::Vector<Item> s21_vector(
+      5ull, [](std::size_t i) { return Item(static_cast<int>(i * i)); });
+  const std::vector<Item> vector{Item(0), Item(1), Item(4), Item(9), Item(16)};
+
+  EXPECT_EQ(s21_vector, vector);
+}
+
+TEST(Vector, T33ConstructorGeneratorZero) {
+  const s21::Vector<int> s21_vector(0ull, [](std::size_t) { return 1; });
+
+  EXPECT_TRUE(s21_vector.Empty());
+}
+
 }  // namespace
 
 // GCOVR_EXCL_STOP
@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../../s21_vector.h"
+#include "../counter.h"
+#include "../item.h"
+#include "../vector_helpers.h"
+
+// GCOVR_EXCL_START
+
+namespace {
+
+TEST(Vector, T0GrowthInt) {
+  s21::Vector<int> s21_vector;
+  std::vector<int> vector;
+  for (int i = 0; i < 10000; ++i) {
+    s21_vector.Push_back(i * 7);
+    vector.push_back(i * 7);
+  }
+  ASSERT_EQ(s21_vector.Size(), vector.size());
+  for (std::size_t i = 0ull; i < vector.size(); ++i)
+    EXPECT_EQ(s21_vector[i], vector[i]);
+}
+
+TEST(Vector, T0GrowthString) {
+  s21::Vector<std::string> s21_vector;
+  s21_vector.Push_back(std::string(100, 'a'));
+  const char* buffer = s21_vector[0].data();
+
+  for (int i = 0; i < 1000; ++i) s21_vector.Push_back(std::to_string(i));
+
+  // the strings were moved, not copied, so the heap buffer is the same
+  EXPECT_EQ(s21_vector[0].data(), buffer);
+  EXPECT_EQ(s21_vector[0], std::string(100, 'a'));
+  EXPECT_EQ(s21_vector[1000], "999");
+}
+
+TEST(Vector, T0GrowthNoCopies) {
+  s21::Vector<Counter> s21_vector;
+  Counter::Reset();
+  for (int i = 0; i < 1000; ++i) s21_vector.Emplace_back(i);
+  s21_vector.Insert(s21_vector.cbegin(), Counter(-1));
+  s21_vector.Erase(s21_vector.cbegin() + 10);
+  s21_vector.Reserve(5000);
+  s21_vector.Shrink_to_fit();
+  EXPECT_EQ(Counter::copies, 0ull);
+
+  ASSERT_EQ(s21_vector.Size(), 1000ull);
+  EXPECT_EQ(s21_vector[0], Counter(-1));
+  EXPECT_EQ(s21_vector[9], Counter(8));
+  EXPECT_EQ(s21_vector[10], Counter(10));
+  EXPECT_EQ(s21_vector[999], Counter(999));
+}
+
+TEST(Vector, T0GrowthMoveOnly) {
+  s21::Vector<std::unique_ptr<int>> s21_vector;
+  for (int i = 0; i < 100; ++i)
+    s21_vector.Push_back(std::make_unique<int>(i));
+
+  s21_vector.Insert(s21_vector.cbegin() + 50, std::make_unique<int>(-50));
+  s21_vector.Emplace(s21_vector.cbegin(), new int(-1));
+  s21_vector.Erase(s21_vector.cbegin() + 1, s21_vector.cbegin() + 11);
+
+  std::vector<int> expected{-1};
+  for (int i = 10; i < 100; ++i) {
+    if (i == 50) expected.push_back(-50);
+    expected.push_back(i);
+  }
+  ASSERT_EQ(s21_vector.Size(), expected.size());
+  for (std::size_t i = 0ull; i < expected.size(); ++i)
+    EXPECT_EQ(*s21_vector[i], expected[i]);
+}
+
+TEST(Vector, T0GrowthThrowingMove) {
+  // Item may throw when moved, so it is copied on reallocation
+  s21::Vector<Item> s21_vector;
+  std::vector<Item> vector;
+  for (int i = 0; i < 100; ++i) {
+    s21_vector.Push_back(Item(i));
+    vector.push_back(Item(i));
+  }
+  s21_vector.Insert(s21_vector.cbegin() + 3, Item(-3));
+  vector.insert(vector.cbegin() + 3, Item(-3));
+  s21_vector.Erase(s21_vector.cbegin() + 7, s21_vector.cbegin() + 20);
+  vector.erase(vector.cbegin() + 7, vector.cbegin() + 20);
+
+  EXPECT_EQ(s21_vector, vector);
+}
+
+}  // namespace
+
+// GCOVR_EXCL_STOP
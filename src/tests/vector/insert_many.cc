@@ -1,11 +1,14 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <deque>
 #include <list>
 #include <stack>
+#include <string>
 #include <vector>
 
 #include "../../s21_vector.h"
+#include "../counter.h"
 #include "../item.h"
 #include "../vector_helpers.h"
 
@@ -184,6 +187,128 @@ TEST(Vector, T4InsertManyZero) {
   EXPECT_EQ(*s21_result, Item(555, 'j', 0.555));
 }
 
+TEST(Vector, T5InsertManyRelocatesTailOnce) {
+  s21::Vector<Counter> s21_vector;
+  s21_vector.Reserve(16ull);
+  for (int i = 0; i < 10; ++i) s21_vector.Emplace_back(i);
+  Counter::Reset();
+
+  s21::Vector<Counter>::iterator s21_result = s21_vector.Insert_many(
+      s21_vector.cbegin() + 5, Counter(-1), Counter(-2), Counter(-3));
+
+  // the tail of 5 is moved once and the arguments are moved into place
+  EXPECT_EQ(Counter::moves, 5ull + 3ull);
+  EXPECT_EQ(Counter::copies, 0ull);
+  EXPECT_EQ(*s21_result, Counter(5));
+  EXPECT_EQ(s21_vector.Size(), 13ull);
+  EXPECT_EQ(s21_vector[5ull], Counter(-1));
+  EXPECT_EQ(s21_vector[7ull], Counter(-3));
+}
+
+TEST(Vector, T6InsertManyGrowsOnce) {
+  s21::Vector<Counter, s21::Growth::Exact> s21_vector;
+  for (int i = 0; i < 4; ++i) s21_vector.Emplace_back(i);
+  Counter::Reset();
+
+  s21_vector.Insert_many(s21_vector.cbegin() + 1, Counter(-1), Counter(-2));
+
+  // every old element is moved once straight to its new place
+  EXPECT_EQ(Counter::moves, 4ull + 2ull);
+  EXPECT_EQ(s21_vector.Capacity(), 6ull);
+  const std::vector<Counter> vector{Counter(0),  Counter(-1), Counter(-2),
+                                    Counter(1),  Counter(2),  Counter(3)};
+  EXPECT_TRUE(std::equal(s21_vector.cbegin(), s21_vector.cend(),
+                         vector.cbegin(), vector.cend()));
+}
+
+TEST(Vector, T7InsertManyBackOwnElement) {
+  s21::Vector<Item, s21::Growth::Exact> s21_vector{Item(1), Item(2)};
+
+  // arguments are still valid while the new memory is filled
+  s21_vector.Insert_many_back(s21_vector[0ull], s21_vector[1ull]);
+
+  const std::vector<Item> vector{Item(1), Item(2), Item(1), Item(2)};
+  EXPECT_EQ(s21_vector, vector);
+}
+
+// the argument is an element of the tail which moves to make room
+s21::Vector<std::string> ownElementVector() {
+  s21::Vector<std::string> s21_vector{std::string(32, 'a'),
+                                      std::string(32, 'b'),
+                                      std::string(32, 'c')};
+  s21_vector.Reserve(8ull);
+  return s21_vector;
+}
+
+TEST(Vector, T8InsertOwnElement) {
+  s21::Vector<std::string> s21_vector = ownElementVector();
+
+  s21_vector.Insert(s21_vector.cbegin(), s21_vector[1ull]);
+
+  const std::vector<std::string> vector{
+      std::string(32, 'b'), std::string(32, 'a'), std::string(32, 'b'),
+      std::string(32, 'c')};
+  EXPECT_EQ(s21_vector.Capacity(), 8ull);
+  EXPECT_TRUE(std::equal(s21_vector.cbegin(), s21_vector.cend(),
+                         vector.cbegin(), vector.cend()));
+}
+
+TEST(Vector, T9InsertCountOwnElement) {
+  s21::Vector<std::string> s21_vector = ownElementVector();
+
+  s21_vector.Insert(s21_vector.cbegin() + 1, 2ull, s21_vector[2ull]);
+
+  const std::vector<std::string> vector{
+      std::string(32, 'a'), std::string(32, 'c'), std::string(32, 'c'),
+      std::string(32, 'b'), std::string(32, 'c')};
+  EXPECT_TRUE(std::equal(s21_vector.cbegin(), s21_vector.cend(),
+                         vector.cbegin(), vector.cend()));
+}
+
+TEST(Vector, T10EmplaceOwnElement) {
+  s21::Vector<std::string> s21_vector = ownElementVector();
+
+  s21_vector.Emplace(s21_vector.cbegin(), s21_vector[1ull]);
+  s21_vector.Emplace(s21_vector.cbegin(), std::move(s21_vector[3ull]));
+
+  const std::vector<std::string> vector{
+      std::string(32, 'c'), std::string(32, 'b'), std::string(32, 'a'),
+      std::string(32, 'b'), std::string()};
+  EXPECT_TRUE(std::equal(s21_vector.cbegin(), s21_vector.cend(),
+                         vector.cbegin(), vector.cend()));
+}
+
+TEST(Vector, T11InsertManyOwnElements) {
+  s21::Vector<std::string> s21_vector = ownElementVector();
+
+  s21_vector.Insert_many(s21_vector.cbegin(), s21_vector[2ull],
+                         std::string(32, 'd'), s21_vector[1ull]);
+
+  const std::vector<std::string> vector{
+      std::string(32, 'c'), std::string(32, 'd'), std::string(32, 'b'),
+      std::string(32, 'a'), std::string(32, 'b'), std::string(32, 'c')};
+  EXPECT_TRUE(std::equal(s21_vector.cbegin(), s21_vector.cend(),
+                         vector.cbegin(), vector.cend()));
+}
+
+TEST(Vector, T0InsertRangeIntoMiddle) {
+  s21::Vector<Counter> s21_vector;
+  for (int i = 0; i < 100000; ++i) s21_vector.Emplace_back(i);
+  std::vector<Counter> source;
+  for (int i = 0; i < 1000; ++i) source.emplace_back(-i);
+  Counter::Reset();
+
+  s21_vector.Insert(s21_vector.cbegin() + 50000, source.cbegin(),
+                    source.cend());
+
+  EXPECT_EQ(Counter::copies, 1000ull);
+  EXPECT_LE(Counter::moves, 100000ull);
+  EXPECT_EQ(s21_vector.Size(), 101000ull);
+  EXPECT_EQ(s21_vector[49999ull], Counter(49999));
+  EXPECT_EQ(s21_vector[50999ull], Counter(-999));
+  EXPECT_EQ(s21_vector[51000ull], Counter(50000));
+}
+
 }  // namespace
 
 // GCOVR_EXCL_STOP
\ No newline at end of file
@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "../../s21_mmap_allocator.h"
+#include "../../s21_vector.h"
+#include "../item.h"
+#include "../vector_helpers.h"
+
+// GCOVR_EXCL_START
+
+namespace {
+
+// small threshold for the tests: one page
+template <typename Type>
+using MmapVector =
+    s21::Vector<Type, s21::Growth::PowerOfTwo, s21::MmapAllocator<Type, 4096>>;
+
+TEST(Vector, T0MmapAllocatorGrowth) {
+  MmapVector<std::uint64_t> s21_vector;
+  std::vector<std::uint64_t> vector;
+  for (std::uint64_t i = 0ull; i < 1000000ull; ++i) {
+    s21_vector.Push_back(i * 3ull);
+    vector.push_back(i * 3ull);
+  }
+
+  EXPECT_TRUE(s21_vector == vector);
+}
+
+TEST(Vector, T0MmapAllocatorReserveAndShrink) {
+  MmapVector<int> s21_vector;
+  s21_vector.Reserve(100000ull);
+  for (int i = 0; i < 3000; ++i) s21_vector.Push_back(i);
+
+  s21_vector.Shrink_to_fit();
+  EXPECT_EQ(s21_vector.Capacity(), 3000ull);
+  s21_vector.Resize(10ull);
+  s21_vector.Shrink_to_fit();  // back below the threshold
+  s21_vector.Append_uninitialized(5000ull)[4999] = -1;
+
+  EXPECT_EQ(s21_vector.Size(), 5010ull);
+  EXPECT_EQ(s21_vector[9ull], 9);
+  EXPECT_EQ(s21_vector.Back(), -1);
+}
+
+TEST(Vector, T0MmapAllocatorNotTrivial) {
+  MmapVector<Item> s21_vector;
+  std::vector<Item> vector;
+  for (int i = 0; i < 1000; ++i) {
+    s21_vector.Push_back(Item(i));
+    vector.push_back(Item(i));
+  }
+
+  EXPECT_EQ(s21_vector, vector);
+}
+
+TEST(Vector, T0MmapAllocatorReallocate) {
+  s21::MmapAllocator<char, 4096> allocator;
+
+  // small chunks are not remapped
+  char* small = allocator.allocate(100ull);
+  EXPECT_EQ(allocator.reallocate(small, 100ull, 200ull), nullptr);
+  allocator.deallocate(small, 100ull);
+
+  char* big = allocator.allocate(8192ull);
+  big[8191] = 'x';
+  big = allocator.reallocate(big, 8192ull, 1ull << 24);
+  ASSERT_NE(big, nullptr);
+  EXPECT_EQ(big[8191], 'x');
+  big[(1ull << 24) - 1ull] = 'y';
+  allocator.deallocate(big, 1ull << 24);
+}
+
+}  // namespace
+
+// GCOVR_EXCL_STOP
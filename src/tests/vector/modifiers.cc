@@ -4,6 +4,7 @@
 #include <iterator>
 #include <list>
 #include <stack>
+#include <stdexcept>
 #include <vector>
 
 #include "../../s21_list.h"
@@ -1382,6 +1383,142 @@ TEST(Vector, T82Resize) {
   EXPECT_EQ(s21_vector, vector);
 }
 
+TEST(Vector, T83ResizeValueInitialized) {
+  s21::Vector<int> s21_vector{1, 2};
+  s21_vector.Resize(4ull);
+
+  EXPECT_TRUE(s21_vector == std::vector<int>({1, 2, 0, 0}));
+}
+
+TEST(Vector, T84ResizeDefaultInit) {
+  s21::Vector<Item> s21_vector{Item(1), Item(2)};
+  std::vector<Item> vector{Item(1), Item(2)};
+
+  // class types are still constructed by their default constructor
+  s21_vector.Resize_default_init(4ull);
+  vector.resize(4ull);
+  EXPECT_EQ(s21_vector, vector);
+
+  s21_vector.Resize_default_init(1ull);
+  vector.resize(1ull);
+  EXPECT_EQ(s21_vector, vector);
+}
+
+TEST(Vector, T85ResizeDefaultInitTrivial) {
+  s21::Vector<unsigned char> s21_vector;
+  s21_vector.Resize_default_init(1000ull);
+  for (std::size_t i = 0ull; i < s21_vector.Size(); ++i)
+    s21_vector[i] = static_cast<unsigned char>(i);
+
+  EXPECT_EQ(s21_vector.Size(), 1000ull);
+  EXPECT_EQ(s21_vector.Capacity(), 1000ull);
+  EXPECT_EQ(s21_vector[999ull], static_cast<unsigned char>(999));
+}
+
+TEST(Vector, T86AppendUninitialized) {
+  s21::Vector<int> s21_vector{1, 2};
+
+  int* room = s21_vector.Append_uninitialized(3ull);
+  for (int i = 0; i < 3; ++i) room[i] = 10 + i;
+  room = s21_vector.Append_uninitialized(2ull);
+  room[0] = 20;
+  room[1] = 21;
+
+  EXPECT_TRUE(s21_vector == std::vector<int>({1, 2, 10, 11, 12, 20, 21}));
+  EXPECT_EQ(s21_vector.Append_uninitialized(0ull), s21_vector.Data() + 7);
+}
+
+// a copy throws once copies_left runs out; there is no move constructor, so
+// the vector copies on relocation
+class Fragile {
+ public:
+  inline static int copies_left = -1;
+  inline static int alive = 0;
+
+  explicit Fragile(int value) : value_{value} { ++alive; }
+  Fragile(const Fragile& other) : value_{other.value_} {
+    copy();
+    ++alive;
+  }
+  Fragile& operator=(const Fragile& other) {
+    copy();
+    value_ = other.value_;
+    return *this;
+  }
+  ~Fragile() { --alive; }
+
+  int value() const noexcept { return value_; }
+
+ private:
+  static void copy() {
+    if (copies_left == 0) throw std::runtime_error("Copy failed!");
+    if (copies_left > 0) --copies_left;
+  }
+
+  int value_;
+};
+
+void ExpectValues(const s21::Vector<Fragile>& s21_vector, int count) {
+  ASSERT_EQ(s21_vector.Size(), static_cast<std::size_t>(count));
+  for (int i = 0; i < count; ++i) EXPECT_EQ(s21_vector[i].value(), i);
+  EXPECT_EQ(Fragile::alive, count);
+}
+
+TEST(Vector, T87ReserveThrowKeepsElements) {
+  {
+    s21::Vector<Fragile> s21_vector;
+    s21_vector.Reserve(5ull);
+    for (int i = 0; i < 5; ++i) s21_vector.Emplace_back(i);
+
+    Fragile::copies_left = 3;
+    EXPECT_THROW(s21_vector.Reserve(10ull), std::runtime_error);
+    Fragile::copies_left = -1;
+
+    EXPECT_EQ(s21_vector.Capacity(), 5ull);
+    ExpectValues(s21_vector, 5);
+  }
+  EXPECT_EQ(Fragile::alive, 0);
+}
+
+TEST(Vector, T88InsertThrowKeepsElements) {
+  {
+    s21::Vector<Fragile> s21_vector;
+    s21_vector.Reserve(10ull);
+    for (int i = 0; i < 5; ++i) s21_vector.Emplace_back(i);
+    const Fragile* data = s21_vector.Data();
+
+    Fragile::copies_left = 2;
+    EXPECT_THROW(s21_vector.Emplace(s21_vector.cbegin() + 1, 7),
+                 std::runtime_error);
+    Fragile::copies_left = -1;
+
+    EXPECT_EQ(s21_vector.Data(), data);
+    ExpectValues(s21_vector, 5);
+
+    s21_vector.Emplace(s21_vector.cbegin() + 5, 5);
+    ExpectValues(s21_vector, 6);
+  }
+  EXPECT_EQ(Fragile::alive, 0);
+}
+
+TEST(Vector, T89EraseThrowKeepsElementsAlive) {
+  {
+    s21::Vector<Fragile> s21_vector;
+    for (int i = 0; i < 5; ++i) s21_vector.Emplace_back(i);
+
+    Fragile::copies_left = 1;
+    EXPECT_THROW(s21_vector.Erase(s21_vector.cbegin()), std::runtime_error);
+    Fragile::copies_left = -1;
+    EXPECT_EQ(s21_vector.Size(), 5ull);
+    EXPECT_EQ(Fragile::alive, 5);
+
+    s21_vector.Erase(s21_vector.cbegin() + 4);
+    EXPECT_EQ(s21_vector.Size(), 4ull);
+    EXPECT_EQ(Fragile::alive, 4);
+  }
+  EXPECT_EQ(Fragile::alive, 0);
+}
+
 }  // namespace
 
 // GCOVR_EXCL_STOP
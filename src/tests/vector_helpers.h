@@ -8,8 +8,8 @@
 
 // GCOVR_EXCL_START
 
-template <typename Type>
-bool operator==(const s21::Vector<Type>& s21_vector,
+template <typename Type, typename... Parameters>
+bool operator==(const s21::Vector<Type, Parameters...>& s21_vector,
                 const std::vector<Type>& vector) {
   if (s21_vector.Size() != vector.size()) return false;
 
@@ -24,24 +24,27 @@ bool operator==(const s21::Vector<Type>& s21_vector,
   return true;
 }
 
-template <typename Type>
-bool operator==(std::vector<Type> vector, s21::Vector<Type> s21_vector) {
+template <typename Type, typename... Parameters>
+bool operator==(std::vector<Type> vector,
+                s21::Vector<Type, Parameters...> s21_vector) {
   return s21_vector == vector;
 }
 
-template <typename Type>
-bool operator!=(const s21::Vector<Type>& s21_vector,
+template <typename Type, typename... Parameters>
+bool operator!=(const s21::Vector<Type, Parameters...>& s21_vector,
                 const std::vector<Type>& vector) {
   return !(s21_vector == vector);
 }
 
-template <typename Type>
-bool operator!=(std::vector<Type> vector, s21::Vector<Type> s21_vector) {
+template <typename Type, typename... Parameters>
+bool operator!=(std::vector<Type> vector,
+                s21::Vector<Type, Parameters...> s21_vector) {
   return !(s21_vector == vector);
 }
 
-template <typename Type>
-std::ostream& operator<<(std::ostream& out, const s21::Vector<Type>& object) {
+template <typename Type, typename... Parameters>
+std::ostream& operator<<(std::ostream& out,
+                         const s21::Vector<Type, Parameters...>& object) {
   out << "Vector: ";
   for (const auto& element : object) out << element << ' ';
   return out;